@@ -0,0 +1,181 @@
+/*
+ * alloc_check.cpp
+ * 
+ * Copyright (C) 2020, Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ * 
+ * This file is part of CEST library.
+ * 
+ * CEST library is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * CEST library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with CEST library. If not, see <http://www.gnu.org/licenses/>.
+ * 
+ */
+
+/**
+ * \brief Allocation check of the per-frame API (StarFilterSW and centroiders with reused buffers).
+ * 
+ * \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ * 
+ * \version 0.1.0
+ * 
+ * \date 18/10/2026
+ * 
+ * \defgroup alloc-check Allocation Check
+ * \ingroup cest
+ * \{
+ */
+
+#include <iostream>
+#include <vector>
+#include <new>
+#include <atomic>
+#include <cstdlib>
+#include <algorithm>
+#include <opencv2/opencv.hpp>
+#include <cest/cest.h>
+
+#define STAR_THRESHOLD_VALUE            150
+#define GAIN_WEIGHT                     0.8
+#define WARM_UP_FRAMES                  3
+#define DEFAULT_ITERATIONS              100
+
+using namespace std;
+using namespace cv;
+using namespace cest;
+
+/**
+ * \brief Number of heap allocations of the process.
+ */
+static atomic<unsigned long> allocations(0);
+
+void* operator new(size_t size)
+{
+    allocations++;
+
+    void *p = malloc(max(size, size_t(1)));
+
+    if (p == NULL)
+    {
+        throw bad_alloc();
+    }
+
+    return p;
+}
+
+void* operator new[](size_t size)
+{
+    return operator new(size);
+}
+
+void operator delete(void *p) noexcept
+{
+    free(p);
+}
+
+void operator delete[](void *p) noexcept
+{
+    free(p);
+}
+
+void operator delete(void *p, size_t) noexcept
+{
+    free(p);
+}
+
+void operator delete[](void *p, size_t) noexcept
+{
+    free(p);
+}
+
+/**
+ * \brief Runs the filter to centroider loop and counts its heap allocations after the warm-up frames.
+ *
+ * \param[in] name is the name of the configuration.
+ *
+ * \param[in] img is the input image.
+ *
+ * \param[in] star_filter is the star filter.
+ *
+ * \param[in] centroider is the centroider.
+ *
+ * \param[in] iterations is the number of checked frames.
+ *
+ * \return True if there were no allocations, or false otherwise.
+ */
+static bool CheckLoop(const string &name, const Mat &img, StarFilterSW &star_filter, Centroider &centroider, unsigned int iterations)
+{
+    vector<StarPixel> star_pixels;
+    vector<Centroid> centroids;
+
+    for(unsigned int i=0; i<WARM_UP_FRAMES; i++)
+    {
+        star_filter.GetStarPixels(img, star_pixels);
+        centroider.ComputeFromList(star_pixels, centroids, GAIN_WEIGHT);
+    }
+
+    unsigned long start = allocations;
+
+    for(unsigned int i=0; i<iterations; i++)
+    {
+        star_filter.GetStarPixels(img, star_pixels);
+        centroider.ComputeFromList(star_pixels, centroids, GAIN_WEIGHT);
+    }
+
+    unsigned long count = allocations - start;
+
+    cout << name << ": " << count << " allocations in " << iterations << " frames (" << star_pixels.size() << " star pixels, ";
+    cout << centroids.size() << " centroids, " << (count == 0 ? "OK" : "FAIL") << ")" << endl;
+
+    return count == 0;
+}
+
+int main(int argc, char **argv)
+{
+    if ((argc < 2) or (argc > 4))
+    {
+        cout << "Usage: " << argv[0] << " image [threads [iterations]]" << endl;
+
+        return -1;
+    }
+
+    Mat img = imread(argv[1], IMREAD_GRAYSCALE);
+
+    if (img.empty())
+    {
+        cout << "Error reading the image " << argv[1] << "!" << endl;
+
+        return -1;
+    }
+
+    unsigned int threads = max((argc > 2) ? atoi(argv[2]) : 1, 1);
+    unsigned int iterations = max((argc > 3) ? atoi(argv[3]) : DEFAULT_ITERATIONS, 1);
+
+    int failures = 0;
+
+    StarFilterSW star_filter(STAR_THRESHOLD_VALUE);
+
+    star_filter.SetNumberOfThreads(threads);
+
+    Centroider cdpu;
+    Centroider cdpu_grid;
+    CentroiderCCL ccl;
+
+    cdpu_grid.SetSpatialIndex(true);
+
+    failures += CheckLoop("CDPU", img, star_filter, cdpu, iterations) ? 0 : 1;
+    failures += CheckLoop("CDPU (grid index)", img, star_filter, cdpu_grid, iterations) ? 0 : 1;
+    failures += CheckLoop("CCL", img, star_filter, ccl, iterations) ? 0 : 1;
+
+    return failures;
+}
+
+//! \} End of alloc-check group
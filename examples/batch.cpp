@@ -0,0 +1,148 @@
+/*
+ * batch.cpp
+ * 
+ * Copyright (C) 2020, Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ * 
+ * This file is part of CEST library.
+ * 
+ * CEST library is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * CEST library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with CEST library. If not, see <http://www.gnu.org/licenses/>.
+ * 
+ */
+
+/**
+ * \brief Batch centroid computation over an image archive.
+ * 
+ * \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ * 
+ * \version 0.1.0
+ * 
+ * \date 18/10/2026
+ * 
+ * \defgroup batch Batch
+ * \ingroup cest
+ * \{
+ */
+
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <chrono>
+#include <cstdlib>
+#include <algorithm>
+#include <stdexcept>
+#include <sys/stat.h>
+#include <opencv2/opencv.hpp>
+#include <cest/cest.h>
+
+#define GAIN_WEIGHT                     0.8
+
+using namespace std;
+using namespace cv;
+
+static bool IsDirectory(const string &path)
+{
+    struct stat st;
+
+    return (stat(path.c_str(), &st) == 0) and S_ISDIR(st.st_mode);
+}
+
+int main(int argc, char **argv)
+{
+    if ((argc < 3) or (argc > 5))
+    {
+        cout << "Usage: " << argv[0] << " images_dir | file_list output_file [threads [threshold]]" << endl;
+
+        return -1;
+    }
+
+    vector<string> files;
+
+    if (IsDirectory(argv[1]))
+    {
+        glob(string(argv[1]) + "/*", files, false);
+
+        sort(files.begin(), files.end());
+    }
+    else
+    {
+        // One file per line
+        ifstream list(argv[1]);
+
+        if (!list.is_open())
+        {
+            cout << "Error opening the file list " << argv[1] << "!" << endl;
+
+            return -1;
+        }
+
+        string line;
+
+        while(getline(list, line))
+        {
+            if (!line.empty())
+            {
+                files.push_back(line);
+            }
+        }
+    }
+
+    BatchProcessor batch((argc > 3) ? atoi(argv[3]) : 0);
+
+    if (argc > 4)
+    {
+        batch.SetThreshold(atoi(argv[4]));
+    }
+
+    batch.SetCorrectionFactor(GAIN_WEIGHT);
+
+    cout << "Processing " << files.size() << " images with " << batch.GetNumberOfThreads() << " threads..." << endl;
+
+    auto t0 = chrono::steady_clock::now();
+
+    size_t processed = 0;
+
+    try
+    {
+        processed = batch.Run(files, argv[2]);
+    }
+    catch(exception &e)
+    {
+        cout << "Error: " << e.what() << endl;
+
+        return -1;
+    }
+
+    double total_time = chrono::duration<double>(chrono::steady_clock::now() - t0).count();
+
+    vector<BatchError> errors = batch.GetErrors();
+
+    for(size_t i=0; i<errors.size(); i++)
+    {
+        cout << "Frame " << errors[i].frame << ": " << errors[i].message << endl;
+    }
+
+    cout << processed << " images processed (" << errors.size() << " errors) in " << total_time << " s";
+
+    if (total_time > 0)
+    {
+        cout << " (" << processed/total_time << " images/s)";
+    }
+
+    cout << endl;
+
+    return errors.empty() ? 0 : 1;
+}
+
+//! \} End of batch group
@@ -0,0 +1,215 @@
+/*
+ * ccl_bench.cpp
+ * 
+ * Copyright (C) 2020, Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ * 
+ * This file is part of CEST library.
+ * 
+ * CEST library is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * CEST library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with CEST library. If not, see <http://www.gnu.org/licenses/>.
+ * 
+ */
+
+/**
+ * \brief Centroider engines benchmark (CentroiderCCL against the CDPU Centroider).
+ * 
+ * \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ * 
+ * \version 0.1.0
+ * 
+ * \date 18/10/2026
+ * 
+ * \defgroup ccl-bench CCL Benchmark
+ * \ingroup cest
+ * \{
+ */
+
+#include <iostream>
+#include <vector>
+#include <chrono>
+#include <random>
+#include <cmath>
+#include <cstdlib>
+#include <algorithm>
+#include <opencv2/opencv.hpp>
+#include <cest/cest.h>
+
+#define STAR_THRESHOLD_VALUE            150
+#define GAIN_WEIGHT                     0.8
+#define IMAGE_SIZE                      1024
+#define STAR_SIGMA                      1.2         /**< Standard deviation of the star profiles in pixels. */
+#define STAR_RADIUS                     5           /**< Radius of the drawn star profiles in pixels. */
+#define BACKGROUND_VALUE                20
+#define MATCH_DISTANCE                  3.0         /**< Maximum distance between a centroid and its star in pixels. */
+#define DEFAULT_STARS                   200
+#define DEFAULT_ITERATIONS              20
+
+using namespace std;
+using namespace cv;
+using namespace cest;
+
+/**
+ * \brief Draws a synthetic star field with known sub-pixel positions.
+ *
+ * \param[in] n is the number of stars (less stars are drawn if they do not fit in the image).
+ *
+ * \param[out] stars receives the true positions of the stars.
+ *
+ * \return The star field image.
+ */
+static Mat DrawStarField(unsigned int n, vector<Centroid> &stars)
+{
+    Mat img(IMAGE_SIZE, IMAGE_SIZE, CV_8UC1);
+
+    vector<double> field(IMAGE_SIZE*IMAGE_SIZE, BACKGROUND_VALUE);
+
+    mt19937 rng(1);
+    uniform_real_distribution<double> pos(STAR_RADIUS + 1, IMAGE_SIZE - STAR_RADIUS - 2);
+    uniform_real_distribution<double> peak(180, 255);
+
+    stars.clear();
+
+    // The number of tries is limited, as a dense field cannot fit all the stars
+    for(unsigned int tries=0; (stars.size() < n) and (tries < 100*n); tries++)
+    {
+        double x0 = pos(rng);
+        double y0 = pos(rng);
+
+        // The stars do not overlap, so each one is a single blob
+        bool overlap = false;
+
+        for(unsigned int i=0; i<stars.size(); i++)
+        {
+            overlap = overlap or ((fabs(stars[i].x - x0) < 4*STAR_RADIUS) and (fabs(stars[i].y - y0) < 4*STAR_RADIUS));
+        }
+
+        if (overlap)
+        {
+            continue;
+        }
+
+        double a = peak(rng) - BACKGROUND_VALUE;
+
+        for(int y=int(y0)-STAR_RADIUS; y<=int(y0)+STAR_RADIUS; y++)
+        {
+            for(int x=int(x0)-STAR_RADIUS; x<=int(x0)+STAR_RADIUS; x++)
+            {
+                double r2 = (x - x0)*(x - x0) + (y - y0)*(y - y0);
+
+                field[y*IMAGE_SIZE + x] += a*exp(-r2/(2*STAR_SIGMA*STAR_SIGMA));
+            }
+        }
+
+        stars.push_back(Centroid(0, x0, y0));
+    }
+
+    for(unsigned int i=0; i<field.size(); i++)
+    {
+        img.data[i] = (uint8_t)min(field[i] + 0.5, 255.0);
+    }
+
+    return img;
+}
+
+/**
+ * \brief Runs a centroider engine and prints its time and error.
+ *
+ * \param[in] name is the name of the engine.
+ *
+ * \param[in] centroider is the engine.
+ *
+ * \param[in] star_pixels are the star pixels of the star field.
+ *
+ * \param[in] stars are the true positions of the stars.
+ *
+ * \param[in] iterations is the number of runs.
+ *
+ * \return None.
+ */
+static void RunEngine(const string &name, Centroider &centroider, const vector<StarPixel> &star_pixels, const vector<Centroid> &stars, unsigned int iterations)
+{
+    vector<Centroid> centroids;
+
+    // Warm-up
+    centroider.ComputeFromList(star_pixels, centroids, GAIN_WEIGHT);
+
+    auto t0 = chrono::steady_clock::now();
+
+    for(unsigned int i=0; i<iterations; i++)
+    {
+        centroider.ComputeFromList(star_pixels, centroids, GAIN_WEIGHT);
+    }
+
+    double frame_time = chrono::duration<double>(chrono::steady_clock::now() - t0).count()/iterations;
+
+    // Each star is matched with its nearest centroid
+    unsigned int found = 0;
+    double sq_error = 0;
+
+    for(unsigned int i=0; i<stars.size(); i++)
+    {
+        double best = MATCH_DISTANCE;
+
+        for(unsigned int j=0; j<centroids.size(); j++)
+        {
+            best = min(best, hypot(centroids[j].x - stars[i].x, centroids[j].y - stars[i].y));
+        }
+
+        if (best < MATCH_DISTANCE)
+        {
+            found++;
+            sq_error += best*best;
+        }
+    }
+
+    cout << name << ": " << frame_time*1e3 << " ms/frame, " << centroids.size() << " centroids, ";
+    cout << found << "/" << stars.size() << " stars found, RMS error " << (found ? sqrt(sq_error/found) : 0) << " px" << endl;
+}
+
+int main(int argc, char **argv)
+{
+    if (argc > 3)
+    {
+        cout << "Usage: " << argv[0] << " [stars [iterations]]" << endl;
+
+        return -1;
+    }
+
+    unsigned int n_stars = (argc > 1) ? atoi(argv[1]) : DEFAULT_STARS;
+    unsigned int iterations = max((argc > 2) ? atoi(argv[2]) : DEFAULT_ITERATIONS, 1);
+
+    vector<Centroid> stars;
+
+    Mat img = DrawStarField(n_stars, stars);
+
+    StarFilterSW star_filter(STAR_THRESHOLD_VALUE);
+
+    vector<StarPixel> star_pixels;
+
+    star_filter.GetStarPixels(img, star_pixels);
+
+    cout << stars.size() << " stars, " << star_pixels.size() << " star pixels" << endl;
+
+    // The CDPU engine drops the stars after its limit, so it is also run with a CDPU per star
+    Centroider cdpu;
+    Centroider cdpu_all(stars.size());
+    CentroiderCCL ccl;
+
+    RunEngine("CDPU (" + to_string(CENTROIDER_DEFAULT_MAX_CDPUS) + " CDPUs)", cdpu, star_pixels, stars, iterations);
+    RunEngine("CDPU (" + to_string(stars.size()) + " CDPUs)", cdpu_all, star_pixels, stars, iterations);
+    RunEngine("CCL", ccl, star_pixels, stars, iterations);
+
+    return 0;
+}
+
+//! \} End of ccl-bench group
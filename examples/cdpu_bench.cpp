@@ -0,0 +1,177 @@
+/*
+ * cdpu_bench.cpp
+ * 
+ * Copyright (C) 2020, Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ * 
+ * This file is part of CEST library.
+ * 
+ * CEST library is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * CEST library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with CEST library. If not, see <http://www.gnu.org/licenses/>.
+ * 
+ */
+
+/**
+ * \brief CDPU bank benchmark (Centroider from 20 to 1000 CDPUs, with and without the grid index).
+ * 
+ * \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ * 
+ * \version 0.1.0
+ * 
+ * \date 18/10/2026
+ * 
+ * \defgroup cdpu-bench CDPU Benchmark
+ * \ingroup cest
+ * \{
+ */
+
+#include <iostream>
+#include <vector>
+#include <chrono>
+#include <random>
+#include <cmath>
+#include <cstdlib>
+#include <algorithm>
+#include <opencv2/opencv.hpp>
+#include <cest/cest.h>
+
+#define STAR_THRESHOLD_VALUE            150
+#define GAIN_WEIGHT                     0.8
+#define IMAGE_SIZE                      2048
+#define STAR_RADIUS                     2           /**< Radius of the drawn stars in pixels. */
+#define BACKGROUND_VALUE                20
+#define DEFAULT_ITERATIONS              10
+
+using namespace std;
+using namespace cv;
+using namespace cest;
+
+/**
+ * \brief Draws a synthetic star field with a star for each CDPU.
+ *
+ * \param[in] n is the number of stars.
+ *
+ * \return The star field image.
+ */
+static Mat DrawStarField(unsigned int n)
+{
+    Mat img(IMAGE_SIZE, IMAGE_SIZE, CV_8UC1);
+
+    fill(img.data, img.data + IMAGE_SIZE*IMAGE_SIZE, BACKGROUND_VALUE);
+
+    mt19937 rng(1);
+    uniform_int_distribution<int> pos(STAR_RADIUS, IMAGE_SIZE - STAR_RADIUS - 1);
+
+    for(unsigned int i=0; i<n; i++)
+    {
+        int x0 = pos(rng);
+        int y0 = pos(rng);
+
+        for(int y=y0-STAR_RADIUS; y<=y0+STAR_RADIUS; y++)
+        {
+            for(int x=x0-STAR_RADIUS; x<=x0+STAR_RADIUS; x++)
+            {
+                uint8_t value = 255 - 30*(abs(x - x0) + abs(y - y0));
+
+                img.data[y*IMAGE_SIZE + x] = max(img.data[y*IMAGE_SIZE + x], value);
+            }
+        }
+    }
+
+    return img;
+}
+
+/**
+ * \brief Measures the time per frame of a centroider.
+ *
+ * \param[in] centroider is the centroider.
+ *
+ * \param[in] star_pixels are the star pixels of the frame.
+ *
+ * \param[out] centroids receives the centroids of the frame.
+ *
+ * \param[in] iterations is the number of runs.
+ *
+ * \return The time per frame in seconds.
+ */
+static double TimeFrame(Centroider &centroider, const vector<StarPixel> &star_pixels, vector<Centroid> &centroids, unsigned int iterations)
+{
+    // Warm-up
+    centroider.ComputeFromList(star_pixels, centroids, GAIN_WEIGHT);
+
+    auto t0 = chrono::steady_clock::now();
+
+    for(unsigned int i=0; i<iterations; i++)
+    {
+        centroider.ComputeFromList(star_pixels, centroids, GAIN_WEIGHT);
+    }
+
+    return chrono::duration<double>(chrono::steady_clock::now() - t0).count()/iterations;
+}
+
+int main(int argc, char **argv)
+{
+    if (argc > 2)
+    {
+        cout << "Usage: " << argv[0] << " [iterations]" << endl;
+
+        return -1;
+    }
+
+    unsigned int iterations = max((argc > 1) ? atoi(argv[1]) : DEFAULT_ITERATIONS, 1);
+
+    const unsigned int sizes[] = {20, 50, 100, 200, 500, 1000};
+
+    StarFilterSW star_filter(STAR_THRESHOLD_VALUE);
+
+    vector<StarPixel> star_pixels;
+    vector<Centroid> linear_centroids;
+    vector<Centroid> grid_centroids;
+    int failures = 0;
+
+    for(unsigned int i=0; i<sizeof(sizes)/sizeof(sizes[0]); i++)
+    {
+        unsigned int n = sizes[i];
+
+        star_filter.GetStarPixels(DrawStarField(n), star_pixels);
+
+        Centroider linear(n);
+        Centroider grid(n);
+
+        grid.SetSpatialIndex(true);
+
+        double linear_time  = TimeFrame(linear, star_pixels, linear_centroids, iterations);
+        double grid_time    = TimeFrame(grid, star_pixels, grid_centroids, iterations);
+
+        // The grid index must give the same centroids of the linear scan (and in the same order)
+        bool ok = (linear_centroids.size() == grid_centroids.size());
+
+        for(unsigned int j=0; ok and (j<linear_centroids.size()); j++)
+        {
+            ok = (linear_centroids[j].x == grid_centroids[j].x) and (linear_centroids[j].y == grid_centroids[j].y) and
+                 (linear_centroids[j].value == grid_centroids[j].value) and (linear_centroids[j].pixels == grid_centroids[j].pixels);
+        }
+
+        cout << n << " CDPUs: linear " << linear_time*1e3 << " ms/frame, grid " << grid_time*1e3 << " ms/frame, speedup ";
+        cout << linear_time/grid_time << " (" << star_pixels.size() << " star pixels, " << linear_centroids.size() << " centroids, ";
+        cout << (ok ? "OK" : "FAIL") << ")" << endl;
+
+        if (!ok)
+        {
+            failures++;
+        }
+    }
+
+    return failures;
+}
+
+//! \} End of cdpu-bench group
@@ -0,0 +1,120 @@
+/*
+ * centroider_hw_check.cpp
+ * 
+ * Copyright (C) 2020, Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ * 
+ * This file is part of CEST library.
+ * 
+ * CEST library is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * CEST library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with CEST library. If not, see <http://www.gnu.org/licenses/>.
+ * 
+ */
+
+/**
+ * \brief Hardware centroider check (CentroiderHW against CentroiderFixed and Centroider).
+ * 
+ * \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ * 
+ * \version 0.1.0
+ * 
+ * \date 18/10/2026
+ * 
+ * \defgroup centroider-hw-check Centroider HW Check
+ * \ingroup cest
+ * \{
+ */
+
+#include <iostream>
+#include <vector>
+#include <chrono>
+#include <opencv2/opencv.hpp>
+#include <cest/cest.h>
+
+#define STAR_THRESHOLD_VALUE            150
+
+using namespace std;
+using namespace cv;
+using namespace cest;
+
+int main(int argc, char **argv)
+{
+    if (argc < 2)
+    {
+        cout << "Usage: " << argv[0] << " image1 [image2 ...]" << endl;
+
+        return -1;
+    }
+
+    CentroiderHW hw(STAR_THRESHOLD_VALUE);
+    StarFilterRTL rtl(STAR_THRESHOLD_VALUE);
+
+    // The CentroiderHW class always uses the raw input
+    rtl.SetRawInput(true);
+    CentroiderFixed<> fixed;
+    Centroider centroider;
+
+    int failures = 0;
+
+    for(int i=1; i<argc; i++)
+    {
+        Mat img = imread(argv[i], IMREAD_GRAYSCALE);
+
+        auto t0 = chrono::steady_clock::now();
+
+        vector<Centroid> hw_centroids = hw.GetCentroids(img);
+
+        auto t1 = chrono::steady_clock::now();
+
+        // The reference centroids are computed with the same star pixels of the hardware
+        vector<StarPixel> star_pixels = rtl.GetStarPixels(img);
+
+        vector<Centroid> fixed_centroids;
+        fixed.ComputeFromList(star_pixels, fixed_centroids);
+
+        vector<Centroid> float_centroids = centroider.ComputeFromList(star_pixels);
+
+        // Bit-level comparison (the positions are exact binary fractions)
+        unsigned int mismatch = max(hw_centroids.size(), fixed_centroids.size());
+
+        for(unsigned int j=0; j<min(hw_centroids.size(), fixed_centroids.size()); j++)
+        {
+            if ((hw_centroids[j].x != fixed_centroids[j].x) or (hw_centroids[j].y != fixed_centroids[j].y) or
+                (hw_centroids[j].value != fixed_centroids[j].value) or (hw_centroids[j].pixels != fixed_centroids[j].pixels))
+            {
+                mismatch = j;
+
+                break;
+            }
+        }
+
+        bool ok = (hw_centroids.size() == fixed_centroids.size()) and (mismatch == hw_centroids.size());
+
+        double mean_error;
+        double max_error = fixed.ErrorFrom(float_centroids, mean_error);
+
+        cout << argv[i] << ": " << (ok ? "OK" : "FAIL");
+        cout << " (HW: " << hw_centroids.size() << " centroids in " << chrono::duration<double>(t1 - t0).count() << " s";
+        cout << ", error from Centroider: max. " << max_error << " px, mean " << mean_error << " px)" << endl;
+
+        if (!ok)
+        {
+            cout << "    First mismatch at centroid " << mismatch << endl;
+
+            failures++;
+        }
+    }
+
+    return failures;
+}
+
+//! \} End of centroider-hw-check group
@@ -0,0 +1,439 @@
+/*
+ * hw_sw_check.cpp
+ * 
+ * Copyright (C) 2020, Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ * 
+ * This file is part of CEST library.
+ * 
+ * CEST library is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * CEST library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with CEST library. If not, see <http://www.gnu.org/licenses/>.
+ * 
+ */
+
+/**
+ * \brief HW/SW equivalence check over a directory of images.
+ * 
+ * \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ * 
+ * \version 0.1.0
+ * 
+ * \date 18/10/2026
+ * 
+ * \defgroup hw-sw-check HW/SW Check
+ * \ingroup cest
+ * \{
+ */
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include <memory>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <limits>
+#include <algorithm>
+#include <stdexcept>
+#include <opencv2/opencv.hpp>
+#include <cest/cest.h>
+
+#define STAR_THRESHOLD_VALUE            150
+#define GAIN_WEIGHT                     0.8
+#define MAX_NUMBER_OF_CENTROIDS         60
+#define CENTROID_MAX_ERROR_PX           0.01        /**< Maximum distance between two matching centroids. */
+#define DEFAULT_SUMMARY_FILE            "hw_sw_check.csv"
+
+using namespace std;
+using namespace cv;
+using namespace cest;
+
+/**
+ * \brief Result of the check of one frame.
+ */
+struct FrameResult
+{
+    string file;                    /**< Image file. */
+    bool ok;                        /**< True if the HW and SW results are equivalent. */
+    string error;                   /**< Error message (if the frame could not be checked). */
+    size_t sw_pixels;               /**< Number of star pixels of the software filter. */
+    size_t hw_pixels;               /**< Number of star pixels of the hardware filter. */
+    size_t sw_only;                 /**< Star pixels found only by the software filter. */
+    size_t hw_only;                 /**< Star pixels found only by the hardware filter. */
+    size_t quirk_pixels;            /**< Star pixels of the known quirks of the hardware simulation (not compared). */
+    size_t sw_centroids;            /**< Number of centroids from the software star pixels. */
+    size_t hw_centroids;            /**< Number of centroids from the hardware star pixels. */
+    double centroid_error;          /**< Maximum distance from a hardware centroid to the closest software centroid. */
+    double sw_time;                 /**< Software filter time in milliseconds. */
+    double hw_time;                 /**< Hardware filter time in milliseconds. */
+    double centroider_time;         /**< Centroider time (both lists) in milliseconds. */
+};
+
+/**
+ * \brief Objects of a worker thread (the filters and the centroider are not shared between threads).
+ */
+struct Worker
+{
+    StarFilterSW sw;                /**< Software star filter. */
+    StarFilterHW hw;                /**< Hardware star filter (with its own scratch directory). */
+    Centroider centroider;          /**< Centroider. */
+
+    Worker()
+        : sw(STAR_THRESHOLD_VALUE), hw(STAR_THRESHOLD_VALUE), centroider(MAX_NUMBER_OF_CENTROIDS)
+    {
+        // The images can have any size (the Netpbm input is limited to the 800x600 sensor)
+        this->hw.SetRawInput(true);
+    }
+};
+
+static double Milliseconds(chrono::steady_clock::time_point t0, chrono::steady_clock::time_point t1)
+{
+    return chrono::duration<double, milli>(t1 - t0).count();
+}
+
+static bool StarPixelLess(const StarPixel &a, const StarPixel &b)
+{
+    if (a.y != b.y)
+    {
+        return a.y < b.y;
+    }
+
+    if (a.x != b.x)
+    {
+        return a.x < b.x;
+    }
+
+    return a.value < b.value;
+}
+
+static bool StarPixelEqual(const StarPixel &a, const StarPixel &b)
+{
+    return (a.y == b.y) and (a.x == b.x) and (a.value == b.value);
+}
+
+/**
+ * \brief Counts the star pixels of a list that are not in another list (repeated star pixels are counted).
+ */
+static size_t CountMissing(const vector<StarPixel> &a, const vector<StarPixel> &b)
+{
+    size_t count = 0;
+    size_t j = 0;
+
+    for(size_t i=0; i<a.size(); i++)
+    {
+        while((j < b.size()) and StarPixelLess(b[j], a[i]))
+        {
+            j++;
+        }
+
+        if ((j < b.size()) and StarPixelEqual(a[i], b[j]))
+        {
+            j++;
+        }
+        else
+        {
+            count++;
+        }
+    }
+
+    return count;
+}
+
+/**
+ * \brief Masks the known quirks of the hardware simulation (see the StarFilterRTL class) in the star pixel lists.
+ *
+ * The sensor does not send the last image row, so the software star pixels of this row are removed. A star pixel at the
+ * end of a row is logged once per blank region cycle, and with the row counter already incremented, so the hardware
+ * star pixels of the last column are moved back one row and their repetitions are removed. The hardware list is sorted
+ * by this function.
+ *
+ * \return The number of masked star pixels.
+ */
+static size_t MaskQuirks(vector<StarPixel> &sw_pixels, vector<StarPixel> &hw_pixels, unsigned int width, unsigned int height)
+{
+    size_t sw_size = sw_pixels.size();
+    size_t hw_size = hw_pixels.size();
+
+    sw_pixels.erase(remove_if(sw_pixels.begin(), sw_pixels.end(), [height](const StarPixel &p)
+        {
+            return p.y == height - 1;
+        }), sw_pixels.end());
+
+    for(size_t i=0; i<hw_pixels.size(); i++)
+    {
+        if ((hw_pixels[i].x == width - 1) and (hw_pixels[i].y > 0))
+        {
+            hw_pixels[i].y--;
+        }
+    }
+
+    sort(hw_pixels.begin(), hw_pixels.end(), StarPixelLess);
+
+    // Only the last column pixels can be repeated (each pixel of the software filter is unique)
+    auto repeated = [width](const StarPixel &a, const StarPixel &b)
+        {
+            return (a.x == width - 1) and StarPixelEqual(a, b);
+        };
+
+    hw_pixels.erase(unique(hw_pixels.begin(), hw_pixels.end(), repeated), hw_pixels.end());
+
+    return (sw_size - sw_pixels.size()) + (hw_size - hw_pixels.size());
+}
+
+/**
+ * \brief Maximum distance from a centroid of a list to the closest centroid of a reference list.
+ */
+static double MaxCentroidError(const vector<Centroid> &centroids, const vector<Centroid> &ref)
+{
+    double max_error = 0;
+
+    for(size_t i=0; i<centroids.size(); i++)
+    {
+        double error = numeric_limits<double>::infinity();
+
+        for(size_t j=0; j<ref.size(); j++)
+        {
+            error = min(error, sqrt(pow(centroids[i].x - ref[j].x, 2) + pow(centroids[i].y - ref[j].y, 2)));
+        }
+
+        max_error = max(max_error, error);
+    }
+
+    return max_error;
+}
+
+static void CheckFrame(Worker &w, FrameResult &res)
+{
+    // PNM files are mapped in memory and filtered in place (without decoding or copying the pixels)
+    MappedFrame mapped;
+    Mat img;
+
+    // Only 8-bit files are mapped, as the star filters read 8-bit pixels (16-bit and ASCII files are decoded by cv::imread())
+    int pnm_type = MappedFrame::IsPNM(res.file) ? MappedFrame::GetPNMType(res.file) : -1;
+
+    if ((pnm_type == CV_8UC1) or (pnm_type == CV_8UC3))
+    {
+        mapped.Open(res.file);
+
+        img = mapped.GetImage();
+    }
+    else
+    {
+        img = imread(res.file, IMREAD_GRAYSCALE);
+    }
+
+    if (img.empty())
+    {
+        throw runtime_error("Impossible to read the image");
+    }
+
+    auto t0 = chrono::steady_clock::now();
+
+    vector<StarPixel> sw_pixels = w.sw.GetStarPixels(img);
+
+    auto t1 = chrono::steady_clock::now();
+
+    vector<StarPixel> hw_pixels = w.hw.GetStarPixels(img);
+
+    auto t2 = chrono::steady_clock::now();
+
+    res.sw_pixels       = sw_pixels.size();
+    res.hw_pixels       = hw_pixels.size();
+
+    // The centroids are computed from the masked lists, so the quirks do not change them either
+    sort(sw_pixels.begin(), sw_pixels.end(), StarPixelLess);
+
+    res.quirk_pixels = MaskQuirks(sw_pixels, hw_pixels, img.cols, img.rows);
+
+    res.sw_only = CountMissing(sw_pixels, hw_pixels);
+    res.hw_only = CountMissing(hw_pixels, sw_pixels);
+
+    auto t3 = chrono::steady_clock::now();
+
+    vector<Centroid> sw_centroids = w.centroider.ComputeFromList(sw_pixels, GAIN_WEIGHT);
+    vector<Centroid> hw_centroids = w.centroider.ComputeFromList(hw_pixels, GAIN_WEIGHT);
+
+    auto t4 = chrono::steady_clock::now();
+
+    res.sw_time         = Milliseconds(t0, t1);
+    res.hw_time         = Milliseconds(t1, t2);
+    res.centroider_time = Milliseconds(t3, t4);
+
+    res.sw_centroids    = sw_centroids.size();
+    res.hw_centroids    = hw_centroids.size();
+
+    res.centroid_error = max(MaxCentroidError(hw_centroids, sw_centroids), MaxCentroidError(sw_centroids, hw_centroids));
+
+    res.ok = (res.sw_only == 0) and (res.hw_only == 0) and (res.sw_centroids == res.hw_centroids) and
+             (res.centroid_error <= CENTROID_MAX_ERROR_PX);
+}
+
+int main(int argc, char **argv)
+{
+    if (argc < 2)
+    {
+        cout << "Usage: " << argv[0] << " images_dir [summary_file [threads]]" << endl;
+
+        return -1;
+    }
+
+    string summary_file = (argc > 2) ? argv[2] : DEFAULT_SUMMARY_FILE;
+    unsigned int threads = (argc > 3) ? stoul(argv[3]) : 0;
+
+    vector<string> files;
+    glob(string(argv[1]) + "/*", files, false);
+
+    if (files.empty())
+    {
+        cout << "No images found in " << argv[1] << "!" << endl;
+
+        return -1;
+    }
+
+    vector<FrameResult> results(files.size());
+
+    for(size_t i=0; i<files.size(); i++)
+    {
+        results[i].file = files[i];
+    }
+
+    ThreadPool pool;
+    pool.SetNumberOfThreads(threads);
+
+    unsigned int n_workers = min(pool.GetNumberOfThreads(), (unsigned int)files.size());
+
+    vector<unique_ptr<Worker> > workers;
+
+    for(unsigned int i=0; i<n_workers; i++)
+    {
+        workers.push_back(unique_ptr<Worker>(new Worker));
+    }
+
+    atomic<size_t> next_frame(0);
+    atomic<size_t> done_frames(0);
+
+    auto t0 = chrono::steady_clock::now();
+
+    pool.Run(n_workers, [&](unsigned int k)
+        {
+            for(size_t i=next_frame++; i<results.size(); i=next_frame++)
+            {
+                // A bad frame is reported, and the remaining frames are still checked
+                try
+                {
+                    CheckFrame(*workers[k], results[i]);
+                }
+                catch(exception &e)
+                {
+                    results[i].ok = false;
+                    results[i].error = e.what();
+                }
+
+                size_t done = ++done_frames;
+
+                if ((done % 100 == 0) or (done == results.size()))
+                {
+                    cout << "\r" << done << "/" << results.size() << " frames checked" << flush;
+                }
+            }
+        });
+
+    auto t1 = chrono::steady_clock::now();
+
+    cout << endl;
+
+    CSVWriter summary;
+
+    try
+    {
+        summary.Open(summary_file);
+    }
+    catch(exception &e)
+    {
+        cout << "Error creating the summary file " << summary_file << "!" << endl;
+
+        return -1;
+    }
+
+    vector<string> header = {"file", "ok", "sw_pixels", "hw_pixels", "sw_only", "hw_only", "quirk_pixels", "sw_centroids",
+                             "hw_centroids", "centroid_error", "sw_time_ms", "hw_time_ms", "centroider_time_ms", "error"};
+
+    summary.WriteRow(header);
+
+    unsigned int failures = 0;
+    unsigned int checked = 0;
+    double sw_time = 0, hw_time = 0, centroider_time = 0;
+
+    for(size_t i=0; i<results.size(); i++)
+    {
+        const FrameResult &r = results[i];
+
+        if (!r.ok)
+        {
+            failures++;
+        }
+
+        summary.WriteCell(r.file);
+        summary.WriteCell(r.ok ? 1 : 0);
+
+        if (!r.error.empty())
+        {
+            for(unsigned int c=0; c<11; c++)
+            {
+                summary.WriteCell("");
+            }
+
+            summary.WriteCell(r.error);
+            summary.EndRow();
+
+            continue;
+        }
+
+        summary.WriteCell(r.sw_pixels);
+        summary.WriteCell(r.hw_pixels);
+        summary.WriteCell(r.sw_only);
+        summary.WriteCell(r.hw_only);
+        summary.WriteCell(r.quirk_pixels);
+        summary.WriteCell(r.sw_centroids);
+        summary.WriteCell(r.hw_centroids);
+        summary.WriteCell(r.centroid_error);
+        summary.WriteCell(r.sw_time);
+        summary.WriteCell(r.hw_time);
+        summary.WriteCell(r.centroider_time);
+        summary.WriteCell("");
+        summary.EndRow();
+
+        sw_time         += r.sw_time;
+        hw_time         += r.hw_time;
+        centroider_time += r.centroider_time;
+
+        checked++;
+    }
+
+    if (checked > 0)
+    {
+        sw_time         /= checked;
+        hw_time         /= checked;
+        centroider_time /= checked;
+    }
+
+    summary.Close();
+
+    cout << results.size() - failures << "/" << results.size() << " frames OK (" << n_workers << " threads, ";
+    cout << chrono::duration<double>(t1 - t0).count() << " s)" << endl;
+    cout << "Mean time per frame: SW " << sw_time << " ms, HW " << hw_time << " ms, centroider " << centroider_time << " ms" << endl;
+    cout << "Summary written to " << summary_file << endl;
+
+    return (failures > 0) ? 1 : 0;
+}
+
+//! \} End of hw-sw-check group
@@ -0,0 +1,142 @@
+/*
+ * replay.cpp
+ * 
+ * Copyright (C) 2020, Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ * 
+ * This file is part of CEST library.
+ * 
+ * CEST library is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * CEST library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with CEST library. If not, see <http://www.gnu.org/licenses/>.
+ * 
+ */
+
+/**
+ * \brief Replay of a frame sequence through the star filter and the centroider.
+ * 
+ * \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ * 
+ * \version 0.1.0
+ * 
+ * \date 18/10/2026
+ * 
+ * \defgroup replay Replay
+ * \ingroup cest
+ * \{
+ */
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include <memory>
+#include <chrono>
+#include <cstdlib>
+#include <stdexcept>
+#include <sys/stat.h>
+#include <opencv2/opencv.hpp>
+#include <cest/cest.h>
+
+#define STAR_THRESHOLD_VALUE            150
+#define GAIN_WEIGHT                     0.8
+#define MAX_NUMBER_OF_CENTROIDS         60
+
+using namespace std;
+using namespace cv;
+using namespace cest;
+
+static double Milliseconds(chrono::steady_clock::time_point t0, chrono::steady_clock::time_point t1)
+{
+    return chrono::duration<double, milli>(t1 - t0).count();
+}
+
+static bool IsDirectory(const string &path)
+{
+    struct stat st;
+
+    return (stat(path.c_str(), &st) == 0) and S_ISDIR(st.st_mode);
+}
+
+int main(int argc, char **argv)
+{
+    if ((argc != 2) and (argc != 4))
+    {
+        cout << "Usage: " << argv[0] << " images_dir | video | raw_file width height" << endl;
+
+        return -1;
+    }
+
+    unique_ptr<FrameSource> source;
+
+    try
+    {
+        if (argc == 4)
+        {
+            source.reset(new FrameSourceRaw(argv[1], atoi(argv[2]), atoi(argv[3])));
+        }
+        else if (IsDirectory(argv[1]))
+        {
+            source.reset(new FrameSourceDir(argv[1]));
+        }
+        else
+        {
+            source.reset(new FrameSourceVideo(argv[1]));
+        }
+    }
+    catch(exception &e)
+    {
+        cout << "Error opening " << argv[1] << ": " << e.what() << endl;
+
+        return -1;
+    }
+
+    StarFilterSW star_filter(STAR_THRESHOLD_VALUE);
+    Centroider centroider(MAX_NUMBER_OF_CENTROIDS);
+
+    // The frames are filtered and centroided in parallel threads (see the Pipeline class)
+    Pipeline pipeline(&star_filter, &centroider);
+
+    pipeline.SetCorrectionFactor(GAIN_WEIGHT);
+
+    unsigned long total_star_pixels = 0, total_centroids = 0;
+
+    auto start = chrono::steady_clock::now();
+
+    unsigned long frames = 0;
+
+    try
+    {
+        frames = pipeline.Run(*source, [&](const PipelineFrame &frame)
+        {
+            total_star_pixels   += frame.star_pixels.size();
+            total_centroids     += frame.centroids.size();
+        });
+    }
+    catch(exception &e)
+    {
+        cout << "Error processing frame " << source->GetFrameIndex() << ": " << e.what() << endl;
+
+        return -1;
+    }
+
+    double total_time = Milliseconds(start, chrono::steady_clock::now());
+
+    cout << frames << " frames, " << total_star_pixels << " star pixels, " << total_centroids << " centroids" << endl;
+
+    if (frames > 0)
+    {
+        cout << "Throughput: " << 1000.0*frames/total_time << " frames/s" << endl;
+    }
+
+    return 0;
+}
+
+//! \} End of replay group
@@ -0,0 +1,155 @@
+/*
+ * rtl_check.cpp
+ * 
+ * Copyright (C) 2020, Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ * 
+ * This file is part of CEST library.
+ * 
+ * CEST library is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * CEST library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with CEST library. If not, see <http://www.gnu.org/licenses/>.
+ * 
+ */
+
+/**
+ * \brief RTL model check (StarFilterRTL against the GHDL simulation).
+ * 
+ * \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ * 
+ * \version 0.1.0
+ * 
+ * \date 18/10/2026
+ * 
+ * \defgroup rtl-check RTL Check
+ * \ingroup cest
+ * \{
+ */
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include <chrono>
+#include <opencv2/opencv.hpp>
+#include <cest/cest.h>
+
+#define STAR_THRESHOLD_VALUE            150
+#define EDGE_CASE_WIDTH                 513         /**< Crop width of the raw input check (the x counter counts up to 512). */
+#define EDGE_CASE_HEIGHT                512         /**< Crop height of the raw input check (the y counter counts up to 512). */
+
+using namespace std;
+using namespace cv;
+using namespace cest;
+
+/**
+ * \brief Compares the star pixels of the GHDL simulation and of the RTL model for an image.
+ *
+ * \param[in] name is the name of the check.
+ *
+ * \param[in] img is the image.
+ *
+ * \param[in] hw is the hardware simulation.
+ *
+ * \param[in] rtl is the RTL model (with the same input mode of the hardware simulation).
+ *
+ * \return True if the star pixels are the same, or false otherwise.
+ */
+static bool CheckImage(const string &name, const Mat &img, StarFilterHW &hw, StarFilterRTL &rtl)
+{
+    auto t0 = chrono::steady_clock::now();
+
+    vector<StarPixel> hw_pixels = hw.GetStarPixels(img);
+
+    auto t1 = chrono::steady_clock::now();
+
+    vector<StarPixel> rtl_pixels = rtl.GetStarPixels(img);
+
+    auto t2 = chrono::steady_clock::now();
+
+    // The star pixels must be the same and in the same order of the log file
+    unsigned int mismatch = max(hw_pixels.size(), rtl_pixels.size());
+
+    for(unsigned int j=0; j<min(hw_pixels.size(), rtl_pixels.size()); j++)
+    {
+        if ((hw_pixels[j].value != rtl_pixels[j].value) or (hw_pixels[j].x != rtl_pixels[j].x) or (hw_pixels[j].y != rtl_pixels[j].y))
+        {
+            mismatch = j;
+
+            break;
+        }
+    }
+
+    bool ok = (hw_pixels.size() == rtl_pixels.size()) and (mismatch == hw_pixels.size());
+
+    cout << name << ": " << (ok ? "OK" : "FAIL");
+    cout << " (HW: " << hw_pixels.size() << " pixels in " << chrono::duration<double>(t1 - t0).count() << " s";
+    cout << ", RTL: " << rtl_pixels.size() << " pixels in " << chrono::duration<double>(t2 - t1).count() << " s";
+    cout << ", " << rtl.GetNumberOfCycles() << " cycles)" << endl;
+
+    if (!ok)
+    {
+        cout << "    First mismatch at star pixel " << mismatch << endl;
+    }
+
+    return ok;
+}
+
+int main(int argc, char **argv)
+{
+    if (argc < 2)
+    {
+        cout << "Usage: " << argv[0] << " image1 [image2 ...]" << endl;
+
+        return -1;
+    }
+
+    StarFilterHW hw(STAR_THRESHOLD_VALUE);
+    StarFilterRTL rtl(STAR_THRESHOLD_VALUE);
+
+    int failures = 0;
+
+    for(int i=1; i<argc; i++)
+    {
+        Mat img = imread(argv[i], IMREAD_GRAYSCALE);
+
+        if (img.empty())
+        {
+            cout << argv[i] << ": FAIL (impossible to read the image)" << endl;
+
+            failures++;
+
+            continue;
+        }
+
+        // Each image goes through both input modes of the sensor
+        hw.SetRawInput(false);
+        rtl.SetRawInput(false);
+
+        failures += CheckImage(string(argv[i]) + " (Netpbm)", img, hw, rtl) ? 0 : 1;
+
+        hw.SetRawInput(true);
+        rtl.SetRawInput(true);
+
+        failures += CheckImage(string(argv[i]) + " (raw)", img, hw, rtl) ? 0 : 1;
+
+        // The raw input also checks the widths of the position counters on their edge cases
+        if ((img.cols >= EDGE_CASE_WIDTH) and (img.rows >= EDGE_CASE_HEIGHT))
+        {
+            Mat crop = img(Rect(0, 0, EDGE_CASE_WIDTH, EDGE_CASE_HEIGHT)).clone();
+
+            failures += CheckImage(string(argv[i]) + " (raw, " + to_string(EDGE_CASE_WIDTH) + "x" + to_string(EDGE_CASE_HEIGHT) + ")", crop, hw, rtl) ? 0 : 1;
+        }
+    }
+
+    return failures;
+}
+
+//! \} End of rtl-check group
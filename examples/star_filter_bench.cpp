@@ -0,0 +1,131 @@
+/*
+ * star_filter_bench.cpp
+ * 
+ * Copyright (C) 2020, Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ * 
+ * This file is part of CEST library.
+ * 
+ * CEST library is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * CEST library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with CEST library. If not, see <http://www.gnu.org/licenses/>.
+ * 
+ */
+
+/**
+ * \brief Star filter scaling benchmark (StarFilterSW with 1 to N threads).
+ * 
+ * \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ * 
+ * \version 0.1.0
+ * 
+ * \date 18/10/2026
+ * 
+ * \defgroup star-filter-bench Star Filter Benchmark
+ * \ingroup cest
+ * \{
+ */
+
+#include <iostream>
+#include <vector>
+#include <chrono>
+#include <thread>
+#include <cstdlib>
+#include <algorithm>
+#include <opencv2/opencv.hpp>
+#include <cest/cest.h>
+
+#define STAR_THRESHOLD_VALUE            150
+#define DEFAULT_ITERATIONS              50
+
+using namespace std;
+using namespace cv;
+using namespace cest;
+
+int main(int argc, char **argv)
+{
+    if ((argc < 2) or (argc > 4))
+    {
+        cout << "Usage: " << argv[0] << " image [max_threads [iterations]]" << endl;
+
+        return -1;
+    }
+
+    Mat img = imread(argv[1], IMREAD_GRAYSCALE);
+
+    if (img.empty())
+    {
+        cout << "Error reading the image " << argv[1] << "!" << endl;
+
+        return -1;
+    }
+
+    unsigned int max_threads = (argc > 2) ? atoi(argv[2]) : max(thread::hardware_concurrency(), 1U);
+    unsigned int iterations = (argc > 3) ? atoi(argv[3]) : DEFAULT_ITERATIONS;
+
+    iterations = max(iterations, 1U);
+
+    StarFilterSW star_filter(STAR_THRESHOLD_VALUE);
+
+    vector<StarPixel> reference;
+    vector<StarPixel> star_pixels;
+    double serial_time = 0;
+    int failures = 0;
+
+    for(unsigned int threads=1; threads<=max_threads; threads*=2)
+    {
+        star_filter.SetNumberOfThreads(threads);
+
+        // Warm-up (creates the band buffers)
+        star_filter.GetStarPixels(img, star_pixels);
+
+        auto t0 = chrono::steady_clock::now();
+
+        for(unsigned int i=0; i<iterations; i++)
+        {
+            star_filter.GetStarPixels(img, star_pixels);
+        }
+
+        double frame_time = chrono::duration<double>(chrono::steady_clock::now() - t0).count()/iterations;
+
+        if (threads == 1)
+        {
+            reference   = star_pixels;
+            serial_time = frame_time;
+        }
+
+        // The parallel output must be the same of the serial path (and in the same order)
+        bool ok = (star_pixels.size() == reference.size());
+
+        for(unsigned int i=0; ok and (i<star_pixels.size()); i++)
+        {
+            ok = (star_pixels[i].x == reference[i].x) and (star_pixels[i].y == reference[i].y) and (star_pixels[i].value == reference[i].value);
+        }
+
+        cout << threads << " threads: " << frame_time*1e3 << " ms/frame, speedup " << serial_time/frame_time;
+        cout << " (" << star_pixels.size() << " star pixels, " << (ok ? "OK" : "FAIL") << ")" << endl;
+
+        if (!ok)
+        {
+            failures++;
+        }
+
+        // The last step is the maximum number of threads
+        if ((threads < max_threads) and (threads*2 > max_threads))
+        {
+            threads = max_threads/2;
+        }
+    }
+
+    return failures;
+}
+
+//! \} End of star-filter-bench group
@@ -0,0 +1,282 @@
+/*
+ * batch_processor.h
+ * 
+ * Copyright (C) 2020, Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ * 
+ * This file is part of CEST library.
+ * 
+ * CEST library is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * CEST library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with CEST library. If not, see <http://www.gnu.org/licenses/>.
+ * 
+ */
+
+/**
+ * \brief Batch processor definition.
+ * 
+ * \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ * 
+ * \version 0.1.0
+ * 
+ * \date 18/10/2026
+ * 
+ * \defgroup batch-processor Batch Processor
+ * \ingroup cest
+ * \{
+ */
+
+#ifndef BATCH_PROCESSOR_H_
+#define BATCH_PROCESSOR_H_
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <mutex>
+#include <atomic>
+#include <exception>
+#include <stdint.h>
+#include <opencv2/opencv.hpp>
+
+#include "star_pixel.hpp"
+#include "centroid.hpp"
+#include "star_filter_sw.h"
+#include "centroider.h"
+#include "mapped_frame.h"
+#include "thread_pool.h"
+#include "csv_writer.h"
+
+#define BATCH_PROCESSOR_DEFAULT_THRESHOLD       STAR_FILTER_DEFAULT_THRESHOLD_VAL
+#define BATCH_PROCESSOR_DEFAULT_MAX_CDPUS       60
+
+/**
+ * \brief Error of a frame of a batch.
+ */
+struct BatchError
+{
+    size_t frame;           /**< Frame index (position in the file list). */
+    std::string message;    /**< Error message. */
+};
+
+/**
+ * \brief Computes the centroids of a large list of image files with a pool of threads.
+ *
+ * Each worker thread has its own StarFilterSW and Centroider (and buffers), created once and kept between batches. The
+ * file list is split into one contiguous range per worker, and a worker that finishes its range steals half of the
+ * largest remaining range of another worker, so the load stays balanced when the frames have different costs.
+ *
+ * The centroids of all the frames are written to a single CSV file, one centroid per row with the columns "frame,
+ * pixels, value, x, y" (the frame is the index of the file in the list). The rows of a frame are contiguous, but the
+ * frames are written in the order they are finished. A frame that cannot be read is skipped and reported by the
+ * GetErrors method.
+ */
+class BatchProcessor
+{
+    private:
+
+        /**
+         * \brief State of a worker thread.
+         */
+        struct Worker
+        {
+            StarFilterSW star_filter;                   /**< Star filter of the worker. */
+            Centroider centroider;                      /**< Centroider of the worker. */
+            MappedFrame mapped;                         /**< Mapped image file. */
+            cv::Mat img;                                /**< Decoded image. */
+            std::vector<cest::StarPixel> star_pixels;   /**< Star pixels of the current frame. */
+            std::vector<cest::Centroid> centroids;      /**< Centroids of the current frame. */
+            std::mutex range_mutex;                     /**< Mutex to protect the frame range. */
+            size_t begin;                               /**< First frame of the range. */
+            size_t end;                                 /**< End of the range. */
+        };
+
+        /**
+         * \brief Thread pool.
+         */
+        ThreadPool pool;
+
+        /**
+         * \brief Worker states (one per thread).
+         */
+        std::vector<std::unique_ptr<Worker> > workers;
+
+        /**
+         * \brief Threshold value of the star filters.
+         */
+        uint8_t threshold;
+
+        /**
+         * \brief Number of CDPUs of the centroiders.
+         */
+        unsigned int max_cdpus;
+
+        /**
+         * \brief Correction factor of the centroiders.
+         */
+        float correction_factor;
+
+        /**
+         * \brief True to sort the centroids of each frame by brightness.
+         */
+        bool sort_centroids;
+
+        /**
+         * \brief Output file writer.
+         */
+        CSVWriter output;
+
+        /**
+         * \brief Mutex to protect the output file and the error list.
+         */
+        std::mutex output_mutex;
+
+        /**
+         * \brief Errors of the last batch.
+         */
+        std::vector<BatchError> errors;
+
+        /**
+         * \brief Error that stops the batch (rethrown by the Run method).
+         */
+        std::exception_ptr fatal_error;
+
+        /**
+         * \brief Flag to stop the workers (set after a fatal error).
+         */
+        std::atomic<bool> abort;
+
+        /**
+         * \brief Creates the worker states (one per thread of the pool).
+         *
+         * \return None.
+         */
+        void CreateWorkers();
+
+        /**
+         * \brief Gets the next frame of a worker (from its range, or stolen from another worker).
+         *
+         * \param[in] w is the worker index.
+         *
+         * \param[out] frame receives the frame index.
+         *
+         * \return True if a frame was taken, or false if there are no more frames.
+         */
+        bool NextFrame(unsigned int w, size_t &frame);
+
+        /**
+         * \brief Worker thread loop.
+         *
+         * \param[in] w is the worker index.
+         *
+         * \param[in] files is the file list.
+         *
+         * \return None.
+         */
+        void Work(unsigned int w, const std::vector<std::string> &files);
+
+        /**
+         * \brief Loads an image file into the buffers of a worker.
+         *
+         * \param[in] worker is the worker.
+         *
+         * \param[in] file is the image file.
+         *
+         * \return The loaded image.
+         */
+        cv::Mat LoadImage(Worker &worker, const std::string &file);
+
+    public:
+
+        /**
+         * \brief Class constructor.
+         *
+         * \param[in] threads is the number of threads (0 = number of CPU cores).
+         *
+         * \return None.
+         */
+        BatchProcessor(unsigned int threads=0);
+
+        /**
+         * \brief Sets the number of threads.
+         *
+         * \param[in] n is the new number of threads (0 = number of CPU cores).
+         *
+         * \return None.
+         */
+        void SetNumberOfThreads(unsigned int n);
+
+        /**
+         * \brief Gets the number of threads.
+         *
+         * \return The number of threads.
+         */
+        unsigned int GetNumberOfThreads();
+
+        /**
+         * \brief Sets the threshold value of the star filters.
+         *
+         * \param[in] val is the new threshold value.
+         *
+         * \return None.
+         */
+        void SetThreshold(uint8_t val);
+
+        /**
+         * \brief Sets the number of CDPUs of the centroiders.
+         *
+         * \param[in] n is the new number of CDPUs.
+         *
+         * \return None.
+         */
+        void SetNumberOfCDPUs(unsigned int n);
+
+        /**
+         * \brief Sets the correction factor of the centroiders.
+         *
+         * \param[in] a is the optimal constant to minimize the centroid position error.
+         *
+         * \return None.
+         */
+        void SetCorrectionFactor(float a);
+
+        /**
+         * \brief Enables or disables the sorting of the centroids of each frame by brightness.
+         *
+         * \param[in] en is true to sort the centroids (default), or false to keep the CDPU order.
+         *
+         * \return None.
+         */
+        void SetSortCentroids(bool en);
+
+        /**
+         * \brief Computes the centroids of a list of image files.
+         *
+         * The images are read as 8-bit grayscale images (8-bit binary PGM files are memory-mapped).
+         *
+         * \param[in] files is the list of image files.
+         *
+         * \param[in] output_file is the CSV file to write the centroids.
+         *
+         * \return The number of processed frames (the frames with errors are not included).
+         */
+        size_t Run(const std::vector<std::string> &files, const std::string &output_file);
+
+        /**
+         * \brief Gets the errors of the last batch.
+         *
+         * \return The list of frames that could not be processed, ordered by the frame index.
+         */
+        std::vector<BatchError> GetErrors();
+};
+
+#endif // BATCH_PROCESSOR_H_
+
+//! \} End of batch-processor group
@@ -0,0 +1,330 @@
+/*
+ * blob_forest.hpp
+ * 
+ * Copyright (C) 2020, Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ * 
+ * This file is part of CEST library.
+ * 
+ * CEST library is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * CEST library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with CEST library. If not, see <http://www.gnu.org/licenses/>.
+ * 
+ */
+
+/**
+ * \brief Blob forest class.
+ * 
+ * \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ * 
+ * \version 0.1.0
+ * 
+ * \date 18/10/2026
+ * 
+ * \defgroup blob-forest Blob Forest
+ * \ingroup cest
+ * \{
+ */
+
+#ifndef BLOB_FOREST_HPP_
+#define BLOB_FOREST_HPP_
+
+#include <vector>
+#include <utility>
+#include <stdint.h>
+
+#include "centroid.hpp"
+
+/**
+ * \brief CEST namespace.
+ */
+namespace cest
+{
+    /**
+     * \brief Union-find forest of star pixel blobs with their intensity-weighted moments.
+     *
+     * Each blob slot keeps the sums of v, v*x and v*y of its star pixels, and the sums of two blobs are added when they
+     * are joined. The star pixels are labeled row by row from two arrays with the labels of the previous and the
+     * current rows (blob slot + 1, or 0 for no star pixel). This is the labeling of the CentroiderCCL and
+     * StreamLabeler classes.
+     */
+    class BlobForest
+    {
+        public:
+
+            /**
+             * \brief Class constructor.
+             *
+             * \return None.
+             */
+            BlobForest()
+            {
+
+            }
+
+            /**
+             * \brief Class destructor.
+             *
+             * \return None.
+             */
+            ~BlobForest()
+            {
+
+            }
+
+            /**
+             * \brief Creates a new blob.
+             *
+             * \return The new blob slot.
+             */
+            unsigned int NewBlob()
+            {
+                unsigned int b = this->parent.size();
+
+                this->parent.push_back(b);
+                this->sum_v.push_back(0);
+                this->sum_vx.push_back(0);
+                this->sum_vy.push_back(0);
+                this->count.push_back(0);
+
+                return b;
+            }
+
+            /**
+             * \brief Reuses a blob slot as a new empty blob.
+             *
+             * \param[in] b is the blob slot.
+             *
+             * \return None.
+             */
+            void ResetBlob(unsigned int b)
+            {
+                this->parent[b] = b;
+                this->sum_v[b]  = 0;
+                this->sum_vx[b] = 0;
+                this->sum_vy[b] = 0;
+                this->count[b]  = 0;
+            }
+
+            /**
+             * \brief Finds the root slot of a blob slot.
+             *
+             * \param[in] b is the blob slot.
+             *
+             * \return The root blob slot.
+             */
+            unsigned int Find(unsigned int b)
+            {
+                while(this->parent[b] != b)
+                {
+                    this->parent[b] = this->parent[this->parent[b]];    // Path halving
+                    b = this->parent[b];
+                }
+
+                return b;
+            }
+
+            /**
+             * \brief Joins two blobs (and their moments).
+             *
+             * The lowest root slot is kept, so the blobs keep the order of their first pixels.
+             *
+             * \param[in] b1 is the first blob slot.
+             *
+             * \param[in] b2 is the second blob slot.
+             *
+             * \return The root slot of the joined blob.
+             */
+            unsigned int Union(unsigned int b1, unsigned int b2)
+            {
+                unsigned int r1 = this->Find(b1);
+                unsigned int r2 = this->Find(b2);
+
+                if (r1 == r2)
+                {
+                    return r1;
+                }
+
+                if (r2 < r1)
+                {
+                    std::swap(r1, r2);
+                }
+
+                this->parent[r2] = r1;
+
+                this->sum_v[r1]     += this->sum_v[r2];
+                this->sum_vx[r1]    += this->sum_vx[r2];
+                this->sum_vy[r1]    += this->sum_vy[r2];
+                this->count[r1]     += this->count[r2];
+
+                return r1;
+            }
+
+            /**
+             * \brief Joins the blobs of the 8-connected neighbours of a star pixel that are already labeled.
+             *
+             * The neighbours are the pixels at both sides in the current row and the three pixels above it.
+             *
+             * \param[in] x is the x-axis position of the star pixel.
+             *
+             * \param[in] cur_labels are the labels of the current row (at least x+2 positions).
+             *
+             * \param[in] prev_labels are the labels of the previous row (at least x+2 positions).
+             *
+             * \return The label of the joined blob (root slot + 1), or 0 if the star pixel has no labeled neighbours.
+             */
+            unsigned int JoinNeighbours(unsigned int x, const std::vector<unsigned int> &cur_labels, const std::vector<unsigned int> &prev_labels)
+            {
+                unsigned int neighbours[5] = {0, 0, 0, 0, 0};
+
+                if (x > 0)
+                {
+                    neighbours[0] = cur_labels[x-1];
+                    neighbours[1] = prev_labels[x-1];
+                }
+
+                neighbours[2] = prev_labels[x];
+                neighbours[3] = prev_labels[x+1];
+                neighbours[4] = cur_labels[x+1];
+
+                unsigned int label = 0;
+
+                for(unsigned int i=0; i<5; i++)
+                {
+                    if (neighbours[i] > 0)
+                    {
+                        label = (label == 0) ? this->Find(neighbours[i]-1) + 1 : this->Union(label-1, neighbours[i]-1) + 1;
+                    }
+                }
+
+                return label;
+            }
+
+            /**
+             * \brief Adds a star pixel to a blob.
+             *
+             * \param[in] b is the root blob slot.
+             *
+             * \param[in] x is the x-axis position of the star pixel.
+             *
+             * \param[in] y is the y-axis position of the star pixel.
+             *
+             * \param[in] value is the value of the star pixel.
+             *
+             * \return None.
+             */
+            void Add(unsigned int b, unsigned int x, unsigned int y, uint8_t value)
+            {
+                this->sum_v[b]  += value;
+                this->sum_vx[b] += (uint64_t)value*x;
+                this->sum_vy[b] += (uint64_t)value*y;
+                this->count[b]++;
+            }
+
+            /**
+             * \brief Checks if a blob slot is a root slot.
+             *
+             * \param[in] b is the blob slot.
+             *
+             * \return True if the slot is the root of its blob, or false if it was joined to another blob.
+             */
+            bool IsRoot(unsigned int b) const
+            {
+                return this->parent[b] == b;
+            }
+
+            /**
+             * \brief Gets the total intensity of a blob.
+             *
+             * \param[in] b is the root blob slot.
+             *
+             * \return The sum of the pixel values of the blob.
+             */
+            uint64_t GetIntensity(unsigned int b) const
+            {
+                return this->sum_v[b];
+            }
+
+            /**
+             * \brief Gets the centroid of a blob.
+             *
+             * The centroid position is the intensity-weighted mean position of the blob, and its value is the mean pixel
+             * value (so value*pixels is the total intensity, as in the CDPU centroids).
+             *
+             * \param[in] b is the root blob slot (with a total intensity greater than zero).
+             *
+             * \return The centroid of the blob.
+             */
+            Centroid GetCentroid(unsigned int b) const
+            {
+                Centroid centroid(this->sum_v[b]/this->count[b], double(this->sum_vx[b])/this->sum_v[b], double(this->sum_vy[b])/this->sum_v[b]);
+
+                centroid.pixels = this->count[b];
+
+                return centroid;
+            }
+
+            /**
+             * \brief Gets the number of blob slots.
+             *
+             * \return The number of blob slots (including the joined ones).
+             */
+            unsigned int Size() const
+            {
+                return this->parent.size();
+            }
+
+            /**
+             * \brief Removes all the blobs (the allocated memory is kept).
+             *
+             * \return None.
+             */
+            void Clear()
+            {
+                this->parent.clear();
+                this->sum_v.clear();
+                this->sum_vx.clear();
+                this->sum_vy.clear();
+                this->count.clear();
+            }
+
+        private:
+
+            /**
+             * \brief Parent of each blob slot.
+             */
+            std::vector<unsigned int> parent;
+
+            /**
+             * \brief Sum of the pixel values of each blob slot.
+             */
+            std::vector<uint64_t> sum_v;
+
+            /**
+             * \brief Sum of the pixel values times the x-axis positions of each blob slot.
+             */
+            std::vector<uint64_t> sum_vx;
+
+            /**
+             * \brief Sum of the pixel values times the y-axis positions of each blob slot.
+             */
+            std::vector<uint64_t> sum_vy;
+
+            /**
+             * \brief Number of pixels of each blob slot.
+             */
+            std::vector<unsigned int> count;
+    };
+}
+
+#endif // BLOB_FOREST_HPP_
+
+//! \} End of blob-forest group
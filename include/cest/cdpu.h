@@ -41,6 +41,7 @@
 #include <cmath>
 
 #include "centroid.hpp"
+#include "star_pixel_span.hpp"
 
 /**
  * \brief Pixel distance threshold value (Euclidean distance).
@@ -79,6 +80,21 @@ class CDPU
          */
         float G;
 
+        /**
+         * \brief Adds a new pixel to the centroid estimation (without checking its distance).
+         *
+         * \param[in] x_new is the x position of the new pixel of a star.
+         *
+         * \param[in] y_new is the y position of the new pixel of a star.
+         *
+         * \param[in] color_new is the color value of the new pixel of a star.
+         *
+         * \param[in] a is an optimal constant to minimize the centroid position error.
+         *
+         * \return None.
+         */
+        void Accumulate(unsigned int x_new, unsigned int y_new, uint8_t color_new, float a);
+
     public:
 
         /**
@@ -110,6 +126,20 @@ class CDPU
          */
         void Update(unsigned int x_new, unsigned int y_new, uint8_t color_new, float a=CDPU_DEFAULT_CORRECTION_FACTOR);
 
+        /**
+         * \brief Updates the centroid estimation with a run of contiguous pixels of a star.
+         *
+         * The distance threshold is evaluated once for the whole span (from the current centroid estimation), and all
+         * the pixels of the span inside it are added to the estimation.
+         *
+         * \param[in] span is the span of star pixels.
+         *
+         * \param[in] a is an optimal constant to minimize the centroid position error.
+         *
+         * \return None.
+         */
+        void UpdateSpan(const cest::StarPixelSpan &span, float a=CDPU_DEFAULT_CORRECTION_FACTOR);
+
         /**
          * \brief Sets the values of the centroid.
          *
@@ -141,6 +171,23 @@ class CDPU
          */
         float DistanceFrom(unsigned int x_comp, unsigned int y_comp);
 
+        /**
+         * \brief Calculates the positions of a row that are closer than a given distance from the current centroid estimation.
+         *
+         * The positions are the same ones where DistanceFrom() is lower than the given distance.
+         *
+         * \param[in] y_comp is the y-axis position of the row.
+         *
+         * \param[in] d is the distance threshold.
+         *
+         * \param[out] x_min is the first x-axis position inside the distance threshold.
+         *
+         * \param[out] x_max is the last x-axis position inside the distance threshold.
+         *
+         * \return TRUE/FALSE if there is at least one position of the row inside the distance threshold or not.
+         */
+        bool GetRowRange(unsigned int y_comp, double d, long &x_min, long &x_max);
+
         /**
          * \brief Gets the number of pixels used to calculate the centroid parameters.
          *
@@ -0,0 +1,299 @@
+/*
+ * cdpu_bank.h
+ * 
+ * Copyright (C) 2020, Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ * 
+ * This file is part of CEST library.
+ * 
+ * CEST library is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * CEST library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with CEST library. If not, see <http://www.gnu.org/licenses/>.
+ * 
+ */
+
+/**
+ * \brief CDPU bank definition.
+ * 
+ * \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ * 
+ * \version 0.1.0
+ * 
+ * \date 18/10/2026
+ * 
+ * \defgroup cdpu-bank CDPU Bank
+ * \ingroup cest
+ * \{
+ */
+
+#ifndef CDPU_BANK_H_
+#define CDPU_BANK_H_
+
+#include <vector>
+#include <stdint.h>
+
+#include "cdpu.h"
+#include "centroid.hpp"
+#include "star_pixel_span.hpp"
+
+#define CDPU_BANK_SCALAR            0           /**< Portable scalar implementation. */
+#define CDPU_BANK_AVX2              1           /**< AVX2 implementation (4 CDPUs per instruction). */
+
+/**
+ * \brief A set of CDPUs stored as a structure of arrays.
+ *
+ * The state of all the CDPUs (centroid position, value, pixel weight and number of pixels) is kept in contiguous
+ * arrays, so a new star pixel can be compared against all of them in a single SIMD pass. The results are the same
+ * (bit by bit) of a list of CDPU objects.
+ */
+class CDPUBank
+{
+    private:
+
+        /**
+         * \brief X-axis position of the centroids.
+         */
+        std::vector<double> x;
+
+        /**
+         * \brief Y-axis position of the centroids.
+         */
+        std::vector<double> y;
+
+        /**
+         * \brief Value of the centroids.
+         */
+        std::vector<unsigned int> value;
+
+        /**
+         * \brief Number of pixels of the centroids.
+         */
+        std::vector<unsigned int> pixels;
+
+        /**
+         * \brief Pixel weight of the CDPUs.
+         */
+        std::vector<float> G;
+
+        /**
+         * \brief Update distance threshold as an integer (a pixel updates a CDPU when its distance is lower than it).
+         */
+        int gate;
+
+        /**
+         * \brief Current instruction set.
+         */
+        int isa;
+
+        /**
+         * \brief Adds a new pixel to the centroid estimation of a CDPU (without checking its distance).
+         *
+         * \param[in] k is the CDPU index.
+         *
+         * \param[in] x_new is the x position of the new pixel of a star.
+         *
+         * \param[in] y_new is the y position of the new pixel of a star.
+         *
+         * \param[in] color_new is the color value of the new pixel of a star.
+         *
+         * \param[in] a is an optimal constant to minimize the centroid position error.
+         *
+         * \return None.
+         */
+        void Accumulate(unsigned int k, unsigned int x_new, unsigned int y_new, uint8_t color_new, float a);
+
+    public:
+
+        /**
+         * \brief Class constructor.
+         *
+         * The best instruction set supported by the CPU is selected.
+         *
+         * \return None.
+         */
+        CDPUBank();
+
+        /**
+         * \brief Class destructor.
+         *
+         * \return None.
+         */
+        ~CDPUBank();
+
+        /**
+         * \brief Selects the instruction set of the bank.
+         *
+         * If the given instruction set is not supported by the CPU, the scalar implementation is used.
+         *
+         * \param[in] isa is the instruction set (CDPU_BANK_SCALAR or CDPU_BANK_AVX2).
+         *
+         * \return None.
+         */
+        void SetInstructionSet(int isa);
+
+        /**
+         * \brief Gets the instruction set in use.
+         *
+         * \return The current instruction set.
+         */
+        int GetInstructionSet();
+
+        /**
+         * \brief Reserves memory for a number of CDPUs.
+         *
+         * \param[in] n is the number of CDPUs.
+         *
+         * \return None.
+         */
+        void Reserve(unsigned int n);
+
+        /**
+         * \brief Removes all the CDPUs (the allocated memory is kept).
+         *
+         * \return None.
+         */
+        void Clear();
+
+        /**
+         * \brief Gets the number of CDPUs of the bank.
+         *
+         * \return The number of CDPUs.
+         */
+        unsigned int Size();
+
+        /**
+         * \brief Adds a new CDPU to the bank.
+         *
+         * \param[in] x_new is the x position of the first pixel of the star.
+         *
+         * \param[in] y_new is the y position of the first pixel of the star.
+         *
+         * \param[in] color_new is the color value of the first pixel of the star.
+         *
+         * \return The index of the new CDPU.
+         */
+        unsigned int Add(unsigned int x_new, unsigned int y_new, uint8_t color_new);
+
+        /**
+         * \brief Updates the centroid estimation of all the CDPUs.
+         *
+         * \param[in] x_new is the x position of the new pixel of a star.
+         *
+         * \param[in] y_new is the y position of the new pixel of a star.
+         *
+         * \param[in] color_new is the color value of the new pixel of a star.
+         *
+         * \param[in] a is an optimal constant to minimize the centroid position error.
+         *
+         * \return None.
+         */
+        void Update(unsigned int x_new, unsigned int y_new, uint8_t color_new, float a=CDPU_DEFAULT_CORRECTION_FACTOR);
+
+        /**
+         * \brief Updates the centroid estimation of a single CDPU.
+         *
+         * \param[in] k is the CDPU index.
+         *
+         * \param[in] x_new is the x position of the new pixel of a star.
+         *
+         * \param[in] y_new is the y position of the new pixel of a star.
+         *
+         * \param[in] color_new is the color value of the new pixel of a star.
+         *
+         * \param[in] a is an optimal constant to minimize the centroid position error.
+         *
+         * \return None.
+         */
+        void UpdateCDPU(unsigned int k, unsigned int x_new, unsigned int y_new, uint8_t color_new, float a=CDPU_DEFAULT_CORRECTION_FACTOR);
+
+        /**
+         * \brief Updates the centroid estimation of all the CDPUs with a run of contiguous pixels of a star.
+         *
+         * \param[in] span is the span of star pixels.
+         *
+         * \param[in] a is an optimal constant to minimize the centroid position error.
+         *
+         * \return None.
+         */
+        void UpdateSpan(const cest::StarPixelSpan &span, float a=CDPU_DEFAULT_CORRECTION_FACTOR);
+
+        /**
+         * \brief Updates the centroid estimation of a CDPU with the pixels of a span from a given x-axis position.
+         *
+         * \param[in] k is the index of the CDPU.
+         *
+         * \param[in] span is the span of star pixels.
+         *
+         * \param[in] x_first is the x-axis position of the first pixel to add (the pixels before it are ignored, as the
+         * pixels of the span before the creation of the CDPU).
+         *
+         * \param[in] a is an optimal constant to minimize the centroid position error.
+         *
+         * \return None.
+         */
+        void UpdateSpanCDPU(unsigned int k, const cest::StarPixelSpan &span, unsigned int x_first, float a=CDPU_DEFAULT_CORRECTION_FACTOR);
+
+        /**
+         * \brief Checks if a point is closer than a given distance from any CDPU.
+         *
+         * \param[in] x_comp is the x-axis position of a point.
+         *
+         * \param[in] y_comp is the y-axis position of a point.
+         *
+         * \param[in] d is the distance threshold.
+         *
+         * \return TRUE/FALSE if there is a CDPU closer than the given distance or not.
+         */
+        bool IsCaptured(unsigned int x_comp, unsigned int y_comp, unsigned int d);
+
+        /**
+         * \brief Calculates the Manhattan distance from the centroid estimation of a CDPU to a given point.
+         *
+         * \param[in] k is the CDPU index.
+         *
+         * \param[in] x_comp is the x-axis position of a point.
+         *
+         * \param[in] y_comp is the y-axis position of a point.
+         *
+         * \return The distance in pixels.
+         */
+        float DistanceFrom(unsigned int k, unsigned int x_comp, unsigned int y_comp);
+
+        /**
+         * \brief Calculates the positions of a row that are closer than a given distance from a CDPU.
+         *
+         * \param[in] k is the CDPU index.
+         *
+         * \param[in] y_comp is the y-axis position of the row.
+         *
+         * \param[in] d is the distance threshold.
+         *
+         * \param[out] x_min is the first x-axis position inside the distance threshold.
+         *
+         * \param[out] x_max is the last x-axis position inside the distance threshold.
+         *
+         * \return TRUE/FALSE if there is at least one position of the row inside the distance threshold or not.
+         */
+        bool GetRowRange(unsigned int k, unsigned int y_comp, double d, long &x_min, long &x_max);
+
+        /**
+         * \brief Gets the centroid of a CDPU.
+         *
+         * \param[in] k is the CDPU index.
+         *
+         * \return The estimated centroid.
+         */
+        cest::Centroid GetCentroid(unsigned int k);
+};
+
+#endif // CDPU_BANK_H_
+
+//! \} End of cdpu-bank group
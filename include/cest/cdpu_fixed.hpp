@@ -0,0 +1,286 @@
+/*
+ * cdpu_fixed.hpp
+ * 
+ * Copyright (C) 2020, Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ * 
+ * This file is part of CEST library.
+ * 
+ * CEST library is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * CEST library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with CEST library. If not, see <http://www.gnu.org/licenses/>.
+ * 
+ */
+
+/**
+ * \brief Fixed-point CDPU class.
+ * 
+ * \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ * 
+ * \version 0.1.0
+ * 
+ * \date 18/10/2026
+ * 
+ * \defgroup cdpu-fixed CDPU Fixed
+ * \ingroup cest
+ * \{
+ */
+
+#ifndef CDPU_FIXED_HPP_
+#define CDPU_FIXED_HPP_
+
+#include <stdint.h>
+#include <cmath>
+
+#include "cdpu.h"
+#include "centroid.hpp"
+
+#define CDPU_FIXED_DEFAULT_GAIN_BITS        16          /**< Default number of fractional bits of the pixel weight. */
+#define CDPU_FIXED_DEFAULT_POS_BITS         8           /**< Default number of fractional bits of the centroid position. */
+
+/**
+ * \brief CentroiD Processor Unit with integer-only arithmetic.
+ *
+ * It implements the same algorithm of the CDPU class, but the pixel weight (G) is stored in Q0.GAIN_BITS format and the
+ * centroid position in Q16.POS_BITS format. All the products are computed with 64-bit integers and truncated back to
+ * the storage format, as in a hardware datapath. The centroid value is an integer (as in the CDPU class).
+ *
+ * \tparam GAIN_BITS is the number of fractional bits of the pixel weight and the correction factor (1 to 30).
+ *
+ * \tparam POS_BITS is the number of fractional bits of the centroid position (0 to 15).
+ */
+template<unsigned int GAIN_BITS=CDPU_FIXED_DEFAULT_GAIN_BITS, unsigned int POS_BITS=CDPU_FIXED_DEFAULT_POS_BITS>
+class CDPUFixed
+{
+    static_assert((GAIN_BITS >= 1) and (GAIN_BITS <= 30), "The gain must have 1 to 30 fractional bits!");
+    static_assert(POS_BITS <= 15, "The position must have up to 15 fractional bits!");
+
+    private:
+
+        /**
+         * \brief Centroid x-axis position (Q16.POS_BITS).
+         */
+        uint32_t x;
+
+        /**
+         * \brief Centroid y-axis position (Q16.POS_BITS).
+         */
+        uint32_t y;
+
+        /**
+         * \brief Centroid value.
+         */
+        uint32_t value;
+
+        /**
+         * \brief Number of pixels of the centroid.
+         */
+        uint32_t pixels;
+
+        /**
+         * \brief Pixel weight (Q0.GAIN_BITS).
+         */
+        uint32_t G;
+
+        /**
+         * \brief Optimal constant to minimize the centroid position error (Q0.GAIN_BITS).
+         */
+        uint32_t a;
+
+        /**
+         * \brief Update distance threshold (a pixel updates the CDPU when its distance is lower than it).
+         */
+        uint32_t gate;
+
+    public:
+
+        /**
+         * \brief Number of fractional bits of the pixel weight.
+         */
+        static const unsigned int GAIN_FRAC_BITS = GAIN_BITS;
+
+        /**
+         * \brief Number of fractional bits of the centroid position.
+         */
+        static const unsigned int POS_FRAC_BITS = POS_BITS;
+
+        /**
+         * \brief Constructor.
+         *
+         * \return None.
+         */
+        CDPUFixed()
+        {
+            this->x         = 0;
+            this->y         = 0;
+            this->value     = 0;
+            this->pixels    = 0;
+            this->G         = 1UL << GAIN_BITS;
+
+            // The distance is an integer, so "d < DISTANCE_THRESHOLD_MAN" is the same as "d < ceil(DISTANCE_THRESHOLD_MAN)"
+            this->gate      = std::ceil(DISTANCE_THRESHOLD_MAN);
+
+            this->SetCorrectionFactor(CDPU_DEFAULT_CORRECTION_FACTOR);
+        }
+
+        /**
+         * \brief Destructor.
+         *
+         * \return None.
+         */
+        ~CDPUFixed()
+        {
+
+        }
+
+        /**
+         * \brief Sets the optimal constant to minimize the centroid position error.
+         *
+         * The constant is rounded to the nearest Q0.GAIN_BITS value (this is the only floating-point operation of the class).
+         *
+         * \param[in] a_new is the new constant (0 to 1).
+         *
+         * \return None.
+         */
+        void SetCorrectionFactor(float a_new)
+        {
+            this->a = std::lround(a_new*(1UL << GAIN_BITS));
+        }
+
+        /**
+         * \brief Gets the optimal constant to minimize the centroid position error.
+         *
+         * \return The constant in Q0.GAIN_BITS format.
+         */
+        uint32_t GetCorrectionFactor()
+        {
+            return this->a;
+        }
+
+        /**
+         * \brief Sets the values of the centroid.
+         *
+         * \param[in] x_new is the new x position reference.
+         *
+         * \param[in] y_new is the new y position reference
+         *
+         * \param[in] color_new is the new color (8-bit) value reference.
+         *
+         * \return None.
+         */
+        void SetCentroid(unsigned int x_new, unsigned int y_new, uint8_t color_new)
+        {
+            this->x         = x_new << POS_BITS;
+            this->y         = y_new << POS_BITS;
+            this->value     += color_new;
+            this->pixels    = 1;
+        }
+
+        /**
+         * \brief Updates the centroid estimation.
+         *
+         * \param[in] x_new is the x position of the new pixel of a star.
+         *
+         * \param[in] y_new is the y position of the new pixel of a star.
+         *
+         * \param[in] color_new is the color value of the new pixel of a star.
+         *
+         * \return None.
+         */
+        void Update(unsigned int x_new, unsigned int y_new, uint8_t color_new)
+        {
+            if (this->DistanceFrom(x_new, y_new) < this->gate)
+            {
+                this->G = ((uint64_t)this->G*this->a) >> GAIN_BITS;
+
+                uint64_t g_inv = (1UL << GAIN_BITS) - this->G;
+
+                this->x = ((uint64_t)this->G*this->x + g_inv*(x_new << POS_BITS)) >> GAIN_BITS;
+                this->y = ((uint64_t)this->G*this->y + g_inv*(y_new << POS_BITS)) >> GAIN_BITS;
+
+                this->value = ((uint64_t)this->G*this->value + g_inv*color_new) >> GAIN_BITS;
+                this->pixels++;
+            }
+        }
+
+        /**
+         * \brief Calculates the Manhattan distance from the current centroid estimation to a given point.
+         *
+         * As in the CDPU class, the distance of each axis is truncated to an integer.
+         *
+         * \param[in] x_comp is the x-axis position of a point.
+         *
+         * \param[in] y_comp is the y-axis position of a point.
+         *
+         * \return The distance in pixels.
+         */
+        uint32_t DistanceFrom(unsigned int x_comp, unsigned int y_comp)
+        {
+            int32_t dx = this->x - (x_comp << POS_BITS);
+            int32_t dy = this->y - (y_comp << POS_BITS);
+
+            return ((uint32_t)std::abs(dx) >> POS_BITS) + ((uint32_t)std::abs(dy) >> POS_BITS);
+        }
+
+        /**
+         * \brief Gets the final calculated centroid of a star.
+         *
+         * \return The estimated centroid of the given star.
+         */
+        cest::Centroid GetCentroid()
+        {
+            cest::Centroid centroid(this->value, this->x/double(1UL << POS_BITS), this->y/double(1UL << POS_BITS));
+
+            centroid.pixels = this->pixels;
+
+            return centroid;
+        }
+
+        /**
+         * \brief Gets the raw fixed-point state of the CDPU (as computed by a hardware implementation).
+         *
+         * \param[out] x_raw is the x-axis position (Q16.POS_BITS).
+         *
+         * \param[out] y_raw is the y-axis position (Q16.POS_BITS).
+         *
+         * \param[out] value_raw is the centroid value.
+         *
+         * \param[out] pixels_raw is the number of pixels.
+         *
+         * \return None.
+         */
+        void GetRaw(uint32_t &x_raw, uint32_t &y_raw, uint32_t &value_raw, uint32_t &pixels_raw)
+        {
+            x_raw       = this->x;
+            y_raw       = this->y;
+            value_raw   = this->value;
+            pixels_raw  = this->pixels;
+        }
+
+        /**
+         * \brief Calculates the error of the centroid estimation relative to a floating-point CDPU.
+         *
+         * \param[in] ref is the floating-point CDPU updated with the same star pixels.
+         *
+         * \return The distance in pixels between the two centroid estimations.
+         */
+        double ErrorFrom(CDPU &ref)
+        {
+            cest::Centroid c = this->GetCentroid();
+            cest::Centroid c_ref = ref.GetCentroid();
+
+            return std::sqrt(std::pow(c.x - c_ref.x, 2) + std::pow(c.y - c_ref.y, 2));
+        }
+};
+
+#endif // CDPU_FIXED_HPP_
+
+//! \} End of cdpu-fixed group
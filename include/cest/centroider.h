@@ -37,11 +37,16 @@
 #ifndef CENTROIDER_H_
 #define CENTROIDER_H_
 
+#include <string>
 #include <vector>
+#include <utility>
 #include <opencv2/opencv.hpp>
 
-#include "cdpu.h"
+#include "cdpu_bank.h"
+#include "threshold_kernel.h"
 #include "star_pixel.hpp"
+#include "star_pixel_buffer.hpp"
+#include "star_pixel_span.hpp"
 #include "centroid.hpp"
 
 #define CENTROIDER_DEFAULT_MAX_CDPUS                20
@@ -49,6 +54,8 @@
 
 #define CENTROIDER_CDPU_DEFAULT_CORRECTION_FACTOR   0.8
 
+#define CENTROIDER_DEFAULT_SPATIAL_INDEX            false
+
 /**
  * \brief Centroider class.
  */
@@ -57,9 +64,9 @@ class Centroider
     private:
 
         /**
-         * \brief CDPUs list.
+         * \brief CDPUs bank.
          */
-        std::vector<CDPU> cdpus;
+        CDPUBank cdpus;
 
         /**
          * \brief Number of CDPUs.
@@ -71,6 +78,107 @@ class Centroider
          */
         unsigned int distance_threshold;
 
+        /**
+         * \brief Capture ranges of the CDPUs in the row of the current span.
+         */
+        std::vector<std::pair<long, long> > capture_ranges;
+
+        /**
+         * \brief x-axis positions where the CDPUs of the current span were created.
+         */
+        std::vector<unsigned int> span_new_x;
+
+        /**
+         * \brief Threshold-and-compact kernel of the fused filter and centroider path.
+         */
+        ThresholdKernel kernel;
+
+        /**
+         * \brief Positions of the star pixels of the current row (fused filter and centroider path).
+         */
+        std::vector<unsigned int> columns;
+
+        /**
+         * \brief Spatial index flag (TRUE/FALSE = enabled/disabled).
+         */
+        bool spatial_index;
+
+        /**
+         * \brief Size in pixels of a cell of the spatial index grid.
+         */
+        unsigned int grid_cell;
+
+        /**
+         * \brief Number of columns of the spatial index grid.
+         */
+        unsigned int grid_cols;
+
+        /**
+         * \brief Number of rows of the spatial index grid.
+         */
+        unsigned int grid_rows;
+
+        /**
+         * \brief Spatial index grid (list of CDPUs of each cell).
+         */
+        std::vector<std::vector<unsigned int> > grid;
+
+        /**
+         * \brief Grid cell of each CDPU.
+         */
+        std::vector<unsigned int> cdpu_cells;
+
+        /**
+         * \brief CDPUs close to the current star pixel.
+         */
+        std::vector<unsigned int> candidates;
+
+        /**
+         * \brief Computes a new star pixel using the spatial index.
+         *
+         * Only the CDPUs of the grid cells around the pixel are checked. The result is the same as checking all of them.
+         *
+         * \param[in] x is the x-axis position of the star pixel.
+         *
+         * \param[in] y is the y-axis position of the star pixel.
+         *
+         * \param[in] value is the value of the star pixel.
+         *
+         * \param[in] a is an optimal constant to minimize the centroid position error.
+         *
+         * \return None.
+         */
+        void ComputeIndexed(unsigned int x, unsigned int y, uint8_t value, float a);
+
+        /**
+         * \brief Gets the grid cell of a CDPU (from its current centroid estimation).
+         *
+         * \param[in] k is the CDPU index.
+         *
+         * \return The grid cell index.
+         */
+        unsigned int GridCellOf(unsigned int k);
+
+        /**
+         * \brief Moves a CDPU to its current grid cell, if needed.
+         *
+         * \param[in] k is the CDPU index.
+         *
+         * \return None.
+         */
+        void GridMove(unsigned int k);
+
+        /**
+         * \brief Builds the spatial index grid again from the current CDPUs.
+         *
+         * \param[in] cols is the number of columns of the grid.
+         *
+         * \param[in] rows is the number of rows of the grid.
+         *
+         * \return None.
+         */
+        void GridRebuild(unsigned int cols, unsigned int rows);
+
     public:
 
         /**
@@ -94,7 +202,7 @@ class Centroider
          *
          * \return None.
          */
-        ~Centroider();
+        virtual ~Centroider();
 
         /**
          * \brief Sets the number of CDPUs.
@@ -114,6 +222,26 @@ class Centroider
          */
         void SetDistanceThreshold(unsigned int d);
 
+        /**
+         * \brief Enables or disables the spatial index of the CDPUs.
+         *
+         * With the spatial index, each star pixel is compared only with the CDPUs inside a uniform grid around it
+         * (cell size defined by the distance thresholds), instead of with all the CDPUs. The computed centroids are
+         * the same in both modes.
+         *
+         * \param[in] en is TRUE/FALSE to enable/disable the spatial index.
+         *
+         * \return None.
+         */
+        void SetSpatialIndex(bool en);
+
+        /**
+         * \brief Checks if the spatial index of the CDPUs is enabled.
+         *
+         * \return TRUE/FALSE if the spatial index is enabled or not.
+         */
+        bool GetSpatialIndex();
+
         /**
          * \brief Computes a new star pixel.
          *
@@ -123,7 +251,22 @@ class Centroider
          *
          * \return None.
          */
-        void Compute(cest::StarPixel star_pix, float a=CENTROIDER_CDPU_DEFAULT_CORRECTION_FACTOR);
+        void Compute(const cest::StarPixel &star_pix, float a=CENTROIDER_CDPU_DEFAULT_CORRECTION_FACTOR);
+
+        /**
+         * \brief Computes a new star pixel (overload).
+         *
+         * \param[in] x is the x-axis position of the star pixel.
+         *
+         * \param[in] y is the y-axis position of the star pixel.
+         *
+         * \param[in] value is the value of the star pixel.
+         *
+         * \param[in] a is an optimal constant to minimize the centroid position error.
+         *
+         * \return None.
+         */
+        virtual void Compute(unsigned int x, unsigned int y, uint8_t value, float a=CENTROIDER_CDPU_DEFAULT_CORRECTION_FACTOR);
 
         /**
          * \brief Computes the centroids from a list of star pixels.
@@ -134,7 +277,117 @@ class Centroider
          *
          * \return A vector with all the computed centroids.
          */
-        std::vector<cest::Centroid> ComputeFromList(std::vector<cest::StarPixel> stars, float a=CENTROIDER_CDPU_DEFAULT_CORRECTION_FACTOR);
+        std::vector<cest::Centroid> ComputeFromList(const std::vector<cest::StarPixel> &stars, float a=CENTROIDER_CDPU_DEFAULT_CORRECTION_FACTOR);
+
+        /**
+         * \brief Computes the centroids from a list of star pixels into a caller-owned vector.
+         *
+         * The vector keeps its capacity between calls, so no memory is allocated once it is large enough.
+         *
+         * \param[in] stars is a list of star pixels to compute the centroids.
+         *
+         * \param[out] centroids is the vector to store the computed centroids (its previous content is removed).
+         *
+         * \param[in] a is an optimal constant to minimize the centroid position error.
+         *
+         * \return None.
+         */
+        void ComputeFromList(const std::vector<cest::StarPixel> &stars, std::vector<cest::Centroid> &centroids, float a=CENTROIDER_CDPU_DEFAULT_CORRECTION_FACTOR);
+
+        /**
+         * \brief Computes the centroids from a buffer of star pixels.
+         *
+         * \param[in] stars is a buffer of star pixels to compute the centroids.
+         *
+         * \param[in] a is an optimal constant to minimize the centroid position error.
+         *
+         * \return A vector with all the computed centroids.
+         */
+        std::vector<cest::Centroid> ComputeFromList(const cest::StarPixelBuffer &stars, float a=CENTROIDER_CDPU_DEFAULT_CORRECTION_FACTOR);
+
+        /**
+         * \brief Computes the centroids from a buffer of star pixels into a caller-owned vector.
+         *
+         * \param[in] stars is a buffer of star pixels to compute the centroids.
+         *
+         * \param[out] centroids is the vector to store the computed centroids (its previous content is removed).
+         *
+         * \param[in] a is an optimal constant to minimize the centroid position error.
+         *
+         * \return None.
+         */
+        void ComputeFromList(const cest::StarPixelBuffer &stars, std::vector<cest::Centroid> &centroids, float a=CENTROIDER_CDPU_DEFAULT_CORRECTION_FACTOR);
+
+        /**
+         * \brief Computes a new span of star pixels.
+         *
+         * The CDPUs are updated once per span instead of once per pixel: the distance thresholds are evaluated from
+         * the centroid estimations at the beginning of the span. Because of this, the result is close to (but not
+         * exactly the same as) computing the pixels of the span one by one. As in the pixel by pixel computation, a
+         * CDPU created inside the span only receives the pixels from its creation position.
+         *
+         * \param[in] span is the span of star pixels to compute.
+         *
+         * \param[in] a is an optimal constant to minimize the centroid position error.
+         *
+         * \return None.
+         */
+        virtual void Compute(const cest::StarPixelSpan &span, float a=CENTROIDER_CDPU_DEFAULT_CORRECTION_FACTOR);
+
+        /**
+         * \brief Computes the centroids from a list of star pixel spans.
+         *
+         * \param[in] spans is a list of star pixel spans (in raster order) to compute the centroids.
+         *
+         * \param[in] a is an optimal constant to minimize the centroid position error.
+         *
+         * \return A vector with all the computed centroids.
+         */
+        std::vector<cest::Centroid> ComputeFromSpans(const std::vector<cest::StarPixelSpan> &spans, float a=CENTROIDER_CDPU_DEFAULT_CORRECTION_FACTOR);
+
+        /**
+         * \brief Computes the centroids from a list of star pixel spans into a caller-owned vector.
+         *
+         * \param[in] spans is a list of star pixel spans (in raster order) to compute the centroids.
+         *
+         * \param[out] centroids is the vector to store the computed centroids (its previous content is removed).
+         *
+         * \param[in] a is an optimal constant to minimize the centroid position error.
+         *
+         * \return None.
+         */
+        void ComputeFromSpans(const std::vector<cest::StarPixelSpan> &spans, std::vector<cest::Centroid> &centroids, float a=CENTROIDER_CDPU_DEFAULT_CORRECTION_FACTOR);
+
+        /**
+         * \brief Computes the centroids of the stars of an image, filtering and centroiding in a single pass.
+         *
+         * Each row is thresholded and its star pixels are computed while they are still in cache, without building a
+         * list of star pixels. The result is the same of StarFilterSW::GetStarPixels() followed by ComputeFromList().
+         *
+         * \param[in] img is the image to process (8-bit, grayscale or color; color images use the green channel).
+         *
+         * \param[in] threshold is the threshold value (a star pixel must be greater than it).
+         *
+         * \param[in] a is an optimal constant to minimize the centroid position error.
+         *
+         * \return A vector with all the computed centroids.
+         */
+        std::vector<cest::Centroid> ComputeFromImage(const cv::Mat &img, uint8_t threshold, float a=CENTROIDER_CDPU_DEFAULT_CORRECTION_FACTOR);
+
+        /**
+         * \brief Computes the centroids of the stars of an image into a caller-owned vector, filtering and centroiding in a single pass.
+         *
+         * \param[in] img is the image to process (8-bit, grayscale or color; color images use the green channel).
+         *
+         * \param[in] threshold is the threshold value (a star pixel must be greater than it).
+         *
+         * \param[out] centroids is the vector to store the computed centroids (its previous content is removed).
+         *
+         * \param[in] a is an optimal constant to minimize the centroid position error.
+         *
+         * \return None.
+         */
+        void ComputeFromImage(const cv::Mat &img, uint8_t threshold, std::vector<cest::Centroid> &centroids, float a=CENTROIDER_CDPU_DEFAULT_CORRECTION_FACTOR);
 
         /**
          * \brief Gets the last computed centroids.
@@ -143,6 +396,15 @@ class Centroider
          */
         std::vector<cest::Centroid> GetCentroids();
 
+        /**
+         * \brief Gets the last computed centroids into a caller-owned vector.
+         *
+         * \param[out] centroids is the vector to store the centroids (its previous content is removed).
+         *
+         * \return None.
+         */
+        virtual void GetCentroids(std::vector<cest::Centroid> &centroids);
+
         /**
          * \brief Sorts a vector with centroids by their brightness.
          *
@@ -153,11 +415,11 @@ class Centroider
         std::vector<cest::Centroid> SortCentroids(std::vector<cest::Centroid> centroids);
 
         /**
-         * \brief Resets the CDPUs.
+         * \brief Resets the CDPUs (the allocated memory is kept).
          *
          * \return None.
          */
-        void Reset();
+        virtual void Reset();
 
         /**
          * \brief Prints a pack of centroids to a given image.
@@ -185,6 +447,19 @@ class Centroider
          * \return None.
          */
         void SaveCentroids(const char *file_name);
+
+        /**
+         * \brief Save a list of centroids in a CSV file (with the same columns of SaveCentroids(file_name)).
+         *
+         * The rows are formatted directly by a buffered writer (CSVWriter), without an intermediate table.
+         *
+         * \param[in] centroids is the list of centroids to save.
+         *
+         * \param[in] file_name is the name of the CSV file.
+         *
+         * \return None.
+         */
+        static void SaveCentroids(const std::vector<cest::Centroid> &centroids, const std::string &file_name);
 };
 
 #endif // CENTROIDER_H_
@@ -0,0 +1,178 @@
+/*
+ * centroider_ccl.h
+ * 
+ * Copyright (C) 2020, Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ * 
+ * This file is part of CEST library.
+ * 
+ * CEST library is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * CEST library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with CEST library. If not, see <http://www.gnu.org/licenses/>.
+ * 
+ */
+
+/**
+ * \brief Connected-component labeling centroider definition.
+ * 
+ * \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ * 
+ * \version 0.1.0
+ * 
+ * \date 18/10/2026
+ * 
+ * \defgroup centroider-ccl Centroider CCL
+ * \ingroup cest
+ * \{
+ */
+
+#ifndef CENTROIDER_CCL_H_
+#define CENTROIDER_CCL_H_
+
+#include <vector>
+#include <stdint.h>
+
+#include "centroider.h"
+#include "star_pixel_span.hpp"
+#include "blob_forest.hpp"
+#include "centroid.hpp"
+
+/**
+ * \brief Centroider based on connected-component labeling.
+ *
+ * The star pixels are grouped in 8-connected blobs with a union-find structure, and the centroid of each blob is
+ * computed from its exact intensity-weighted moments (sum of v, v*x and v*y). There is no limit to the number of
+ * stars, and each star pixel is processed once.
+ *
+ * Only the current and the previous rows are kept in memory, so the rows of the star pixels must be in increasing order
+ * (as they are given by the star filters). The star pixels of a row can be in any order, and a repeated position is
+ * computed only once, so the output of StarFilterHW (with the star pixels of the last column repeated at the beginning
+ * of the next row) is accepted. The correction factor of the CDPU algorithm is not used.
+ */
+class CentroiderCCL: public Centroider
+{
+    private:
+
+        /**
+         * \brief Blobs and their moments.
+         */
+        cest::BlobForest blobs;
+
+        /**
+         * \brief Labels of the previous row (label + 1, 0 = no star pixel).
+         */
+        std::vector<unsigned int> prev_labels;
+
+        /**
+         * \brief Labels of the current row (label + 1, 0 = no star pixel).
+         */
+        std::vector<unsigned int> cur_labels;
+
+        /**
+         * \brief Positions of the star pixels of the previous row.
+         */
+        std::vector<unsigned int> prev_xs;
+
+        /**
+         * \brief Positions of the star pixels of the current row.
+         */
+        std::vector<unsigned int> cur_xs;
+
+        /**
+         * \brief Current row.
+         */
+        unsigned int row;
+
+        /**
+         * \brief TRUE/FALSE if a star pixel was already computed or not.
+         */
+        bool started;
+
+        /**
+         * \brief Moves to a new row.
+         *
+         * \param[in] y is the new row.
+         *
+         * \return None.
+         */
+        void NextRow(unsigned int y);
+
+    public:
+
+        /**
+         * \brief Class constructor.
+         *
+         * \return None.
+         */
+        CentroiderCCL();
+
+        /**
+         * \brief Class destructor.
+         *
+         * \return None.
+         */
+        ~CentroiderCCL();
+
+        using Centroider::Compute;
+
+        /**
+         * \brief Computes a new star pixel.
+         *
+         * A star pixel in a position already computed is ignored, and a row before the current one gives an exception.
+         *
+         * \param[in] x is the x-axis position of the star pixel.
+         *
+         * \param[in] y is the y-axis position of the star pixel.
+         *
+         * \param[in] value is the value of the star pixel.
+         *
+         * \param[in] a is not used.
+         *
+         * \return None.
+         */
+        void Compute(unsigned int x, unsigned int y, uint8_t value, float a=CENTROIDER_CDPU_DEFAULT_CORRECTION_FACTOR);
+
+        /**
+         * \brief Computes a run of contiguous star pixels of a row.
+         *
+         * \param[in] span is the span of star pixels.
+         *
+         * \param[in] a is not used.
+         *
+         * \return None.
+         */
+        void Compute(const cest::StarPixelSpan &span, float a=CENTROIDER_CDPU_DEFAULT_CORRECTION_FACTOR);
+
+        using Centroider::GetCentroids;
+
+        /**
+         * \brief Gets the centroids of the blobs computed so far.
+         *
+         * The centroid position is the intensity-weighted mean position of the blob, and its value is the mean pixel
+         * value (so value*pixels is the total intensity, as in the CDPU centroids).
+         *
+         * \param[out] centroids is the list to store the centroids.
+         *
+         * \return None.
+         */
+        void GetCentroids(std::vector<cest::Centroid> &centroids);
+
+        /**
+         * \brief Removes all the blobs (the allocated memory is kept).
+         *
+         * \return None.
+         */
+        void Reset();
+};
+
+#endif // CENTROIDER_CCL_H_
+
+//! \} End of centroider-ccl group
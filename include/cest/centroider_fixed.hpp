@@ -0,0 +1,318 @@
+/*
+ * centroider_fixed.hpp
+ * 
+ * Copyright (C) 2020, Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ * 
+ * This file is part of CEST library.
+ * 
+ * CEST library is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * CEST library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with CEST library. If not, see <http://www.gnu.org/licenses/>.
+ * 
+ */
+
+/**
+ * \brief Fixed-point centroider class.
+ * 
+ * \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ * 
+ * \version 0.1.0
+ * 
+ * \date 18/10/2026
+ * 
+ * \defgroup centroider-fixed Centroider Fixed
+ * \ingroup cest
+ * \{
+ */
+
+#ifndef CENTROIDER_FIXED_HPP_
+#define CENTROIDER_FIXED_HPP_
+
+#include <vector>
+#include <limits>
+#include <algorithm>
+#include <cmath>
+
+#include "centroider.h"
+#include "cdpu_fixed.hpp"
+#include "star_pixel.hpp"
+#include "star_pixel_buffer.hpp"
+#include "centroid.hpp"
+
+/**
+ * \brief Centroider with fixed-point CDPUs.
+ *
+ * It implements the same algorithm of the Centroider class (with the linear search of the CDPUs), but with
+ * integer-only arithmetic (see CDPUFixed).
+ *
+ * \tparam GAIN_BITS is the number of fractional bits of the pixel weight and the correction factor.
+ *
+ * \tparam POS_BITS is the number of fractional bits of the centroid position.
+ */
+template<unsigned int GAIN_BITS=CDPU_FIXED_DEFAULT_GAIN_BITS, unsigned int POS_BITS=CDPU_FIXED_DEFAULT_POS_BITS>
+class CentroiderFixed
+{
+    private:
+
+        /**
+         * \brief CDPUs list.
+         */
+        std::vector<CDPUFixed<GAIN_BITS, POS_BITS> > cdpus;
+
+        /**
+         * \brief Initial state of a new CDPU (with the quantized correction factor).
+         */
+        CDPUFixed<GAIN_BITS, POS_BITS> new_cdpu;
+
+        /**
+         * \brief Number of CDPUs.
+         */
+        unsigned int max_cdpus;
+
+        /**
+         * \brief Distance threshold to capture a star pixel.
+         */
+        unsigned int distance_threshold;
+
+    public:
+
+        /**
+         * \brief Class constructor.
+         *
+         * \param[in] n is the maximum number of CDPUs.
+         *
+         * \return None.
+         */
+        CentroiderFixed(unsigned int n=CENTROIDER_DEFAULT_MAX_CDPUS)
+        {
+            this->SetNumberOfCDPUs(n);
+            this->SetDistanceThreshold(CENTROIDER_DEFAULT_DISTANCE_THRESHOLD);
+            this->SetCorrectionFactor(CENTROIDER_CDPU_DEFAULT_CORRECTION_FACTOR);
+        }
+
+        /**
+         * \brief Class destructor.
+         *
+         * \return None.
+         */
+        ~CentroiderFixed()
+        {
+
+        }
+
+        /**
+         * \brief Sets the maximum number of CDPUs.
+         *
+         * \param[in] n is the new maximum number of CDPUs.
+         *
+         * \return None.
+         */
+        void SetNumberOfCDPUs(unsigned int n)
+        {
+            this->max_cdpus = n;
+
+            this->cdpus.reserve(n);
+        }
+
+        /**
+         * \brief Sets the distance threshold to capture a star pixel.
+         *
+         * \param[in] d is the new distance threshold in pixels.
+         *
+         * \return None.
+         */
+        void SetDistanceThreshold(unsigned int d)
+        {
+            this->distance_threshold = d;
+        }
+
+        /**
+         * \brief Sets the optimal constant to minimize the centroid position error.
+         *
+         * The constant is quantized once, and used by all the CDPUs created after this call.
+         *
+         * \param[in] a is the new constant.
+         *
+         * \return None.
+         */
+        void SetCorrectionFactor(float a)
+        {
+            this->new_cdpu.SetCorrectionFactor(a);
+        }
+
+        /**
+         * \brief Computes a new star pixel.
+         *
+         * \param[in] x is the x-axis position of the star pixel.
+         *
+         * \param[in] y is the y-axis position of the star pixel.
+         *
+         * \param[in] value is the value of the star pixel.
+         *
+         * \return None.
+         */
+        void Compute(unsigned int x, unsigned int y, uint8_t value)
+        {
+            if (this->cdpus.size() < this->max_cdpus)
+            {
+                bool pix_capt = false;
+                for(unsigned int k=0; k<this->cdpus.size(); k++)
+                {
+                    if (this->cdpus[k].DistanceFrom(x, y) < this->distance_threshold)
+                    {
+                        pix_capt = true;
+                    }
+                }
+
+                if (!pix_capt)
+                {
+                    this->cdpus.push_back(this->new_cdpu);
+                    this->cdpus[this->cdpus.size()-1].SetCentroid(x, y, value);
+                }
+            }
+
+            for(unsigned int k=0; k<this->cdpus.size(); k++)
+            {
+                this->cdpus[k].Update(x, y, value);
+            }
+        }
+
+        /**
+         * \brief Computes the centroids of a list of star pixels.
+         *
+         * \param[in] stars is the list of star pixels.
+         *
+         * \param[out] centroids is the list to store the computed centroids.
+         *
+         * \return None.
+         */
+        void ComputeFromList(const std::vector<cest::StarPixel> &stars, std::vector<cest::Centroid> &centroids)
+        {
+            this->Reset();
+
+            for(unsigned int i=0; i<stars.size(); i++)
+            {
+                this->Compute(stars[i].x, stars[i].y, stars[i].value);
+            }
+
+            this->GetCentroids(centroids);
+        }
+
+        /**
+         * \brief Computes the centroids of a buffer of star pixels.
+         *
+         * \param[in] stars is the buffer of star pixels.
+         *
+         * \param[out] centroids is the list to store the computed centroids.
+         *
+         * \return None.
+         */
+        void ComputeFromList(const cest::StarPixelBuffer &stars, std::vector<cest::Centroid> &centroids)
+        {
+            this->Reset();
+
+            for(unsigned int i=0; i<stars.Size(); i++)
+            {
+                this->Compute(stars.x[i], stars.y[i], stars.value[i]);
+            }
+
+            this->GetCentroids(centroids);
+        }
+
+        /**
+         * \brief Gets the computed centroids.
+         *
+         * \param[out] centroids is the list to store the centroids.
+         *
+         * \return None.
+         */
+        void GetCentroids(std::vector<cest::Centroid> &centroids)
+        {
+            centroids.clear();
+
+            for(unsigned int i=0; i<this->cdpus.size(); i++)
+            {
+                centroids.push_back(this->cdpus[i].GetCentroid());
+            }
+        }
+
+        /**
+         * \brief Gets a CDPU.
+         *
+         * \param[in] k is the CDPU index.
+         *
+         * \return A reference to the CDPU.
+         */
+        CDPUFixed<GAIN_BITS, POS_BITS>& GetCDPU(unsigned int k)
+        {
+            return this->cdpus[k];
+        }
+
+        /**
+         * \brief Gets the number of CDPUs in use.
+         *
+         * \return The number of CDPUs.
+         */
+        unsigned int GetNumberOfCDPUsInUse()
+        {
+            return this->cdpus.size();
+        }
+
+        /**
+         * \brief Calculates the error of the computed centroids relative to the floating-point centroider.
+         *
+         * Each computed centroid is matched to the closest reference centroid.
+         *
+         * \param[in] ref is the list of centroids computed by the Centroider class with the same star pixels.
+         *
+         * \param[out] mean_error is the mean position error in pixels.
+         *
+         * \return The maximum position error in pixels.
+         */
+        double ErrorFrom(const std::vector<cest::Centroid> &ref, double &mean_error)
+        {
+            double max_error = 0;
+
+            mean_error = 0;
+
+            for(unsigned int i=0; i<this->cdpus.size(); i++)
+            {
+                cest::Centroid c = this->cdpus[i].GetCentroid();
+
+                double error = std::numeric_limits<double>::infinity();
+
+                for(unsigned int j=0; j<ref.size(); j++)
+                {
+                    error = std::min(error, std::sqrt(std::pow(c.x - ref[j].x, 2) + std::pow(c.y - ref[j].y, 2)));
+                }
+
+                max_error = std::max(max_error, error);
+                mean_error += error/this->cdpus.size();
+            }
+
+            return max_error;
+        }
+
+        /**
+         * \brief Resets the CDPUs.
+         *
+         * \return None.
+         */
+        void Reset()
+        {
+            this->cdpus.clear();
+        }
+};
+
+#endif // CENTROIDER_FIXED_HPP_
+
+//! \} End of centroider-fixed group
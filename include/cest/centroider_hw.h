@@ -0,0 +1,243 @@
+/*
+ * centroider_hw.h
+ * 
+ * Copyright (C) 2020, Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ * 
+ * This file is part of CEST library.
+ * 
+ * CEST library is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * CEST library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with CEST library. If not, see <http://www.gnu.org/licenses/>.
+ * 
+ */
+
+/**
+ * \brief Centroider (hardware simulation) definition.
+ * 
+ * \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ * 
+ * \version 0.1.0
+ * 
+ * \date 18/10/2026
+ * 
+ * \defgroup centroider-hw Centroider (HW)
+ * \ingroup cest
+ * \{
+ */
+
+#ifndef CENTROIDER_HW_H_
+#define CENTROIDER_HW_H_
+
+#include <string>
+#include <vector>
+#include <stdint.h>
+#include <opencv2/opencv.hpp>
+
+#include "centroid.hpp"
+#include "centroider.h"
+#include "cdpu_fixed.hpp"
+
+#define CENTROIDER_HW_SCRATCH_DIR_TEMPLATE      "/tmp/cest_cent_XXXXXX"
+#define CENTROIDER_HW_BUFFER_IMG_RAW            "img_buf.raw"           /**< Raw image file (inside the scratch directory). */
+#define CENTROIDER_HW_BUFFER_CENTROIDS          "centroids.csv"         /**< Centroids log file (inside the scratch directory). */
+#define CENTROIDER_HW_SIM_MAX_TIME_US           "200000"
+
+#define CENTROIDER_HW_CENTROIDS_ROW_K           0
+#define CENTROIDER_HW_CENTROIDS_ROW_X           1
+#define CENTROIDER_HW_CENTROIDS_ROW_Y           2
+#define CENTROIDER_HW_CENTROIDS_ROW_VAL         3
+#define CENTROIDER_HW_CENTROIDS_ROW_PIXELS      4
+
+#define CENTROIDER_HW_DEFAULT_THRESHOLD         150
+
+/**
+ * \brief Centroider with the VHDL CDPU bank (simulated with GHDL).
+ *
+ * The image goes through the StarCentroider design (vhdl/cest): the same sensor and threshold blocks of the StarFilter
+ * design, followed by a bank of fixed-point CDPUs. The bank implements the algorithm of the CentroiderFixed class with
+ * the default fixed-point format, so the computed centroids are bit-exact with CentroiderFixed<> fed with the star
+ * pixels of the hardware (the ones returned by StarFilterHW or StarFilterRTL in raw input mode).
+ */
+class CentroiderHW
+{
+    private:
+
+        /**
+         * \brief Pixel threshold value.
+         */
+        uint8_t threshold;
+
+        /**
+         * \brief Number of CDPUs.
+         */
+        unsigned int max_cdpus;
+
+        /**
+         * \brief Distance threshold to capture a star pixel.
+         */
+        unsigned int distance_threshold;
+
+        /**
+         * \brief Correction factor (Q0.CDPU_FIXED_DEFAULT_GAIN_BITS).
+         */
+        uint32_t correction_factor;
+
+        /**
+         * \brief Directory of the temporary files of the simulation.
+         */
+        std::string scratch_dir;
+
+        /**
+         * \brief True if the scratch directory was created by this object (and must be removed by it).
+         */
+        bool scratch_dir_owned;
+
+        /**
+         * \brief Removes the scratch directory (if it was created by this object).
+         *
+         * \return None.
+         */
+        void RemoveScratchDir();
+
+        /**
+         * \brief Runs the GHDL simulation with a given image.
+         *
+         * An exception is thrown if the simulation fails (the centroids log is not created).
+         *
+         * \param[in] img is the input image.
+         *
+         * \return None.
+         */
+        void RunSimulation(const cv::Mat &img);
+
+        /**
+         * \brief Reads the final centroids from the log file of the CDPU bank.
+         *
+         * \param[in] file is the log file ("k,x,y,value,pixels" lines).
+         *
+         * \return The centroids ordered by the CDPU index.
+         */
+        std::vector<cest::Centroid> ReadCentroidsFromFile(const std::string &file);
+
+    public:
+
+        /**
+         * \brief Class constructor.
+         *
+         * \return None.
+         */
+        CentroiderHW();
+
+        /**
+         * \brief Class constructor (overloaded).
+         *
+         * \param[in] thr is the pixel threshold value.
+         *
+         * \return None.
+         */
+        CentroiderHW(uint8_t thr);
+
+        /**
+         * \brief Class destructor.
+         *
+         * \return None.
+         */
+        ~CentroiderHW();
+
+        /**
+         * \brief Clears the temporary files of the simulation.
+         *
+         * \return None.
+         */
+        void Clear();
+
+        /**
+         * \brief Computes the centroids of a given image.
+         *
+         * Only 8-bit images are supported (color images are processed using the green channel).
+         *
+         * \param[in] img is the image to search for the centroids.
+         *
+         * \return The centroids of the image, ordered by the CDPU index.
+         */
+        std::vector<cest::Centroid> GetCentroids(const cv::Mat &img);
+
+        /**
+         * \brief Sets the pixel threshold value.
+         *
+         * The value is given for 8-bit pixels, and it is scaled for 16-bit images (see StarFilterHW::ScaleThreshold()).
+         *
+         * \param[in] val is the new threshold value.
+         *
+         * \return None.
+         */
+        void SetThreshold(uint8_t val);
+
+        /**
+         * \brief Gets the pixel threshold value.
+         *
+         * \return The threshold value.
+         */
+        uint8_t GetThreshold();
+
+        /**
+         * \brief Sets the number of CDPUs of the bank.
+         *
+         * \param[in] n is the new number of CDPUs.
+         *
+         * \return None.
+         */
+        void SetNumberOfCDPUs(unsigned int n);
+
+        /**
+         * \brief Sets the distance threshold to capture a star pixel.
+         *
+         * \param[in] d is the new distance threshold in pixels.
+         *
+         * \return None.
+         */
+        void SetDistanceThreshold(unsigned int d);
+
+        /**
+         * \brief Sets the optimal constant to minimize the centroid position error.
+         *
+         * The constant is quantized as in the CDPUFixed class.
+         *
+         * \param[in] a is the new constant.
+         *
+         * \return None.
+         */
+        void SetCorrectionFactor(float a);
+
+        /**
+         * \brief Sets the directory of the temporary files of the simulation.
+         *
+         * \param[in] dir is an existing directory (it is not removed), or an empty string to use a new temporary
+         * directory (created from CENTROIDER_HW_SCRATCH_DIR_TEMPLATE and removed in the destructor).
+         *
+         * \return None.
+         */
+        void SetScratchDir(const std::string &dir);
+
+        /**
+         * \brief Gets the directory of the temporary files of the simulation.
+         *
+         * A new temporary directory is created if none was set.
+         *
+         * \return The path of the scratch directory.
+         */
+        std::string GetScratchDir();
+};
+
+#endif // CENTROIDER_HW_H_
+
+//! \} End of centroider-hw group
@@ -38,12 +38,35 @@
 
 #define CEST_VERSION    "0.1.0"
 
+#include "batch_processor.h"
+#include "blob_forest.hpp"
+#include "cdpu_bank.h"
+#include "cdpu_fixed.hpp"
 #include "centroid.hpp"
 #include "centroider.h"
+#include "centroider_ccl.h"
+#include "centroider_fixed.hpp"
+#include "centroider_hw.h"
+#include "csv_writer.h"
+#include "frame_source.h"
+#include "frame_source_dir.h"
+#include "frame_source_raw.h"
+#include "frame_source_video.h"
+#include "mapped_frame.h"
+#include "pipeline.h"
+#include "spsc_queue.hpp"
 #include "star_filter.h"
 #include "star_filter_hw.h"
+#include "star_filter_rtl.h"
 #include "star_filter_sw.h"
 #include "star_pixel.hpp"
+#include "star_pixel_buffer.hpp"
+#include "star_pixel_log.h"
+#include "star_pixel_span.hpp"
+#include "stream_labeler.h"
+#include "subprocess.h"
+#include "thread_pool.h"
+#include "threshold_kernel.h"
 
 #endif // CEST_H_
 
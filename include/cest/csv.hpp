@@ -42,17 +42,143 @@
 #include <iostream>
 #include <fstream>
 #include <sstream>
+#include <cstdlib>
+#include <algorithm>
 #include <stdexcept>
+#include <type_traits>
+
+#include "csv_writer.h"
+
+#define CSV_READ_CHUNK_SIZE     (1 << 16)   /**< Read size of the files that cannot be seeked (as FIFOs), in bytes. */
+
+/**
+ * \brief CSV cell parser.
+ *
+ * Integer cells are parsed digit by digit, floating-point cells with strtod(), and any other type with a stringstream.
+ */
+template <class TCell>
+class CSVCell
+{
+    private:
+
+        /**
+         * \brief Kind of cell value (0 = integer, 1 = floating-point, 2 = other).
+         */
+        typedef std::integral_constant<int, std::is_integral<TCell>::value ? 0 : (std::is_floating_point<TCell>::value ? 1 : 2)> CellKind;
+
+        /**
+         * \brief Parses an integer cell.
+         *
+         * \param[in] begin is the first character of the cell.
+         *
+         * \param[in] end is the end of the cell.
+         *
+         * \param[out] val is the cell value.
+         *
+         * \return None.
+         */
+        static void ParseCell(const char *begin, const char *end, TCell &val, std::integral_constant<int, 0>)
+        {
+            while((begin < end) and ((*begin == ' ') or (*begin == '\t')))
+            {
+                begin++;
+            }
+
+            bool neg = false;
+
+            if ((begin < end) and ((*begin == '-') or (*begin == '+')))
+            {
+                neg = (*begin == '-');
+                begin++;
+            }
+
+            TCell v = 0;
+
+            while((begin < end) and (*begin >= '0') and (*begin <= '9'))
+            {
+                v = v*10 + (*begin - '0');
+                begin++;
+            }
+
+            val = neg ? TCell(0) - v : v;
+        }
+
+        /**
+         * \brief Parses a floating-point cell.
+         *
+         * \param[in] begin is the first character of the cell.
+         *
+         * \param[in] end is the end of the cell.
+         *
+         * \param[out] val is the cell value.
+         *
+         * \return None.
+         */
+        static void ParseCell(const char *begin, const char *end, TCell &val, std::integral_constant<int, 1>)
+        {
+            while((begin < end) and ((*begin == ' ') or (*begin == '\t')))
+            {
+                begin++;
+            }
+
+            // strtod() stops at the separator (an empty cell must not be parsed, since the new line is a whitespace)
+            val = (begin < end) ? static_cast<TCell>(std::strtod(begin, NULL)) : TCell();
+        }
+
+        /**
+         * \brief Parses a cell of any other type (with a stringstream).
+         *
+         * \param[in] begin is the first character of the cell.
+         *
+         * \param[in] end is the end of the cell.
+         *
+         * \param[out] val is the cell value.
+         *
+         * \return None.
+         */
+        static void ParseCell(const char *begin, const char *end, TCell &val, std::integral_constant<int, 2>)
+        {
+            std::stringstream convert(std::string(begin, end));
+
+            val = TCell();
+
+            convert >> val;
+        }
+
+    public:
+
+        /**
+         * \brief Parses a cell.
+         *
+         * \param[in] begin is the first character of the cell.
+         *
+         * \param[in] end is the end of the cell (the cell must be followed by a separator, a new line or a null
+         * character).
+         *
+         * \param[out] val is the cell value (a default value if the cell is empty).
+         *
+         * \return None.
+         */
+        static void Parse(const char *begin, const char *end, TCell &val)
+        {
+            ParseCell(begin, end, val, CellKind());
+        }
+};
 
 /**
  * \brief CSV library main class.
+ *
+ * The table is stored by columns (each column is a contiguous vector), and the files are read in a single block and
+ * parsed in place.
  */
 template <class TCell>
 class CSV
 {
     private:
 
-        std::vector<std::vector<TCell> > cells;     /**< CSV table buffer. */
+        std::vector<std::vector<TCell> > columns;   /**< CSV table buffer (one vector per column). */
+
+        unsigned int rows;                          /**< Number of rows of the table. */
 
     public:
 
@@ -63,7 +189,7 @@ class CSV
          */
         CSV()
         {
-
+            this->rows = 0;
         }
 
         /**
@@ -77,17 +203,8 @@ class CSV
          */
         CSV(unsigned int cols, unsigned int rows)
         {
-            std::vector<TCell> row;
-
-            for(unsigned int i=0; i<cols; i++)
-            {
-                row.push_back(TCell());
-            }
-
-            for(unsigned int j=0; j<rows; j++)
-            {
-                this->AppendRow(row);
-            }
+            this->columns.assign(cols, std::vector<TCell>(rows, TCell()));
+            this->rows = rows;
         }
 
         /**
@@ -99,6 +216,8 @@ class CSV
          */
         CSV(const char *in_file)
         {
+            this->rows = 0;
+
             this->Read(in_file);
         }
 
@@ -115,57 +234,138 @@ class CSV
         /**
          * \brief Reads a CSV table from a CSV file.
          *
+         * The number of columns is defined by the first line. Shorter lines are completed with empty cells, and empty
+         * lines are ignored. The file can also be a FIFO (or any other file that cannot be seeked).
+         *
          * \param[in] file is the CSV file to read.
          *
          * \return None.
          */
         void Read(const char *file)
         {
-            // Open a file as an input file
-            std::fstream input(file, std::fstream::in);
+            std::ifstream input(file, std::ifstream::in | std::ifstream::binary);
 
-            if (input.is_open())
+            if (!input.is_open())
             {
-                this->Clear();
+                std::string error_text = "Error openning the input file in ";
+                error_text += __func__;
+                error_text += " method from ";
+                error_text += __FILE__;
+                error_text += " file!";
+                throw std::runtime_error(error_text.c_str());
+            }
 
-                char c;
-                std::string cell_buf;
-                std::vector<TCell> row;
+            std::vector<char> buf;
+            std::streamsize len = 0;
 
-                while(input.get(c))
+            input.seekg(0, std::ifstream::end);
+
+            std::streamoff size = input.tellg();
+
+            if (input and (size >= 0))
+            {
+                // A regular file is read in a single block
+                buf.resize(size + 1);
+
+                input.seekg(0);
+                input.read(buf.data(), size);
+
+                len = input.gcount();
+            }
+            else
+            {
+                // A file that cannot be seeked (as a FIFO) is read in chunks until its end
+                input.clear();
+
+                while(input)
                 {
-                    std::stringstream convert(cell_buf);
-                    TCell val;
+                    buf.resize(len + CSV_READ_CHUNK_SIZE + 1);
 
-                    switch(c)
-                    {
-                        case ',':
-                            convert >> val;
-                            row.push_back(val);
-                            cell_buf = "";
-                            break;
-                        case '\n':
-                            convert >> val;
-                            row.push_back(val);
-                            cell_buf = "";
-                            this->AppendRow(row);
-                            row.clear();
-                            break;
-                        default:
-                            cell_buf += c;
-                    }
+                    input.read(buf.data() + len, CSV_READ_CHUNK_SIZE);
+
+                    len += input.gcount();
                 }
 
-                input.close();
+                buf.resize(len + 1);
             }
-            else
+
+            buf[len] = '\0';
+
+            input.close();
+
+            this->Clear();
+
+            const char *pos = buf.data();
+            const char *buf_end = buf.data() + len;
+
+            // The number of rows is estimated from the length of the first line
+            const char *first_eol = pos;
+
+            while((first_eol < buf_end) and (*first_eol != '\n'))
             {
-                std::string error_text = "Error openning the input file in ";
-                error_text += __func__;
-                error_text += " method from ";
-                error_text += __FILE__;
-                error_text += " file!";
-                throw std::runtime_error(error_text.c_str());
+                first_eol++;
+            }
+
+            size_t rows_hint = len/(first_eol - pos + 1) + 1;
+
+            while(pos < buf_end)
+            {
+                const char *eol = pos;
+
+                while((eol < buf_end) and (*eol != '\n'))
+                {
+                    eol++;
+                }
+
+                const char *line_end = ((eol > pos) and (eol[-1] == '\r')) ? eol - 1 : eol;
+
+                if (line_end > pos)
+                {
+                    unsigned int col = 0;
+                    const char *cell = pos;
+
+                    while(cell <= line_end)
+                    {
+                        const char *cell_end = cell;
+
+                        while((cell_end < line_end) and (*cell_end != ','))
+                        {
+                            cell_end++;
+                        }
+
+                        if (this->rows == 0)
+                        {
+                            this->columns.push_back(std::vector<TCell>());
+                            this->columns.back().reserve(rows_hint);
+                        }
+                        else if (col >= this->columns.size())
+                        {
+                            std::string error_text = "Error reading the input file in ";
+                            error_text += __func__;
+                            error_text += " method from ";
+                            error_text += __FILE__;
+                            error_text += " file: Inconsistent number of columns!";
+                            throw std::runtime_error(error_text.c_str());
+                        }
+
+                        TCell val;
+
+                        CSVCell<TCell>::Parse(cell, cell_end, val);
+
+                        this->columns[col++].push_back(val);
+
+                        cell = cell_end + 1;
+                    }
+
+                    for(; col<this->columns.size(); col++)
+                    {
+                        this->columns[col].push_back(TCell());
+                    }
+
+                    this->rows++;
+                }
+
+                pos = eol + 1;
             }
         }
 
@@ -178,38 +378,19 @@ class CSV
          */
         void Write(const char *file)
         {
-            // Open a file as an output file
-            std::fstream output(file, std::fstream::out);
+            CSVWriter output(file);
 
-            if (output.is_open())
+            for(unsigned int i=0; i<this->rows; i++)
             {
-                for(unsigned int i=0; i<this->cells.size(); i++)
+                for(unsigned int j=0; j<this->columns.size(); j++)
                 {
-                    for(unsigned int j=0; j<this->cells[i].size(); j++)
-                    {
-                        output << this->cells[i][j];
-
-                        if (j < this->cells[i].size()-1)    // Check if it is in the last column
-                        {
-                            output << ",";
-                        }
-                    }
-
-                    // End of column, add a new line
-                    output << std::endl;
+                    output.WriteCell(this->columns[j][i]);
                 }
 
-                output.close();
-            }
-            else
-            {
-                std::string error_text = "Error creating the output file in ";
-                error_text += __func__;
-                error_text += " method from ";
-                error_text += __FILE__;
-                error_text += " file!";
-                throw std::runtime_error(error_text.c_str());
+                output.EndRow();
             }
+
+            output.Close();
         }
 
         /**
@@ -219,7 +400,8 @@ class CSV
          */
         void Clear()
         {
-            this->cells.clear();
+            this->columns.clear();
+            this->rows = 0;
         }
 
         /**
@@ -229,7 +411,7 @@ class CSV
          */
         unsigned int GetColumns()
         {
-            return this->cells[0].size();
+            return this->columns.size();
         }
 
         /**
@@ -239,7 +421,7 @@ class CSV
          */
         unsigned int GetRows()
         {
-            return this->cells.size();
+            return this->rows;
         }
 
         /**
@@ -253,9 +435,9 @@ class CSV
          */
         TCell ReadCell(unsigned int col, unsigned int row)
         {
-            if ((col < this->cells[0].size()) and (row < this->cells.size()))
+            if ((col < this->columns.size()) and (row < this->rows))
             {
-                return this->cells[row][col];
+                return this->columns[col][row];
             }
             else
             {
@@ -281,9 +463,9 @@ class CSV
          */
         void WriteCell(unsigned int col, unsigned int row, TCell val)
         {
-            if ((col < this->cells[0].size()) and (row < this->cells.size()))
+            if ((col < this->columns.size()) and (row < this->rows))
             {
-                this->cells[row][col] = val;
+                this->columns[col][row] = val;
             }
             else
             {
@@ -296,6 +478,30 @@ class CSV
             }
         }
 
+        /**
+         * \brief Gets the data of a column (without copies).
+         *
+         * \param[in] col is the column number.
+         *
+         * \return A pointer to the first cell of the column (valid until the table is modified).
+         */
+        const TCell* GetColumnData(unsigned int col)
+        {
+            if (col < this->columns.size())
+            {
+                return this->columns[col].data();
+            }
+            else
+            {
+                std::string error_text = "Error reading a column in ";
+                error_text += __func__;
+                error_text += " method from ";
+                error_text += __FILE__;
+                error_text += " file: This column does not exist!";
+                throw std::range_error(error_text.c_str());
+            }
+        }
+
         /**
          * \brief Reads of a column from the CSV table.
          *
@@ -305,16 +511,9 @@ class CSV
          */
         std::vector<TCell> ReadColumn(unsigned int col)
         {
-            if (col < this->cells[0].size())
+            if (col < this->columns.size())
             {
-                std::vector<TCell> column;
-
-                for(unsigned int i=0; i<this->cells.size();i++)
-                {
-                    column.push_back(this->cells[i][col]);
-                }
-
-                return column;
+                return this->columns[col];
             }
             else
             {
@@ -336,9 +535,18 @@ class CSV
          */
         std::vector<TCell> ReadRow(unsigned int row)
         {
-            if (row < this->cells.size())
+            if (row < this->rows)
             {
-                return this->cells[row];
+                std::vector<TCell> row_data;
+
+                row_data.reserve(this->columns.size());
+
+                for(unsigned int i=0; i<this->columns.size(); i++)
+                {
+                    row_data.push_back(this->columns[i][row]);
+                }
+
+                return row_data;
             }
             else
             {
@@ -362,11 +570,11 @@ class CSV
          */
         void WriteColumn(unsigned int pos, std::vector<TCell> col)
         {
-            if (pos < this->cells[0].size())
+            if (pos < this->columns.size())
             {
-                for(unsigned int i=0; i<this->cells.size(); i++)
+                for(unsigned int i=0; i<this->rows; i++)
                 {
-                    this->cells[i][pos] = col[i];
+                    this->columns[pos][i] = col[i];
                 }
             }
             else
@@ -391,9 +599,12 @@ class CSV
          */
         void WriteRow(unsigned int pos, std::vector<TCell> row)
         {
-            if (pos < this->cells.size())
+            if (pos < this->rows)
             {
-                this->cells[pos] = row;
+                for(unsigned int i=0; (i<this->columns.size()) and (i<row.size()); i++)
+                {
+                    this->columns[i][pos] = row[i];
+                }
             }
             else
             {
@@ -415,22 +626,43 @@ class CSV
          */
         void AppendColumn(std::vector<TCell> col)
         {
-            for(unsigned int i=0; i<this->cells.size(); i++)
-            {
-                this->cells[i].push_back(col[i]);
-            }
+            col.resize(this->rows, TCell());
+
+            this->columns.push_back(col);
         }
 
         /**
          * \brief Appends a row to the end of the CSV table.
          *
+         * The first row of an empty table defines the number of columns. Shorter rows are completed with empty cells,
+         * and longer rows are an error (as in the Read method).
+         *
          * \param[in] row is the row to append.
          *
          * \return None.
          */
         void AppendRow(std::vector<TCell> row)
         {
-            this->cells.push_back(row);
+            if (this->columns.empty())
+            {
+                this->columns.resize(row.size());
+            }
+            else if (row.size() > this->columns.size())
+            {
+                std::string error_text = "Error appending a row in ";
+                error_text += __func__;
+                error_text += " method from ";
+                error_text += __FILE__;
+                error_text += " file: Inconsistent number of columns!";
+                throw std::range_error(error_text.c_str());
+            }
+
+            for(unsigned int i=0; i<this->columns.size(); i++)
+            {
+                this->columns[i].push_back((i < row.size()) ? row[i] : TCell());
+            }
+
+            this->rows++;
         }
 
         /**
@@ -444,13 +676,13 @@ class CSV
          */
         friend std::ostream& operator<<(std::ostream& os, const CSV<TCell>& csv)
         {
-            for(unsigned int i=0; i<csv.cells.size(); i++)
+            for(unsigned int i=0; i<csv.rows; i++)
             {
-                for(unsigned int j=0; j<csv.cells[i].size(); j++)
+                for(unsigned int j=0; j<csv.columns.size(); j++)
                 {
-                    os << csv.cells[i][j];
+                    os << csv.columns[j][i];
 
-                    if (j < csv.cells[i].size()-1)    // Check if it is in the last column
+                    if (j < csv.columns.size()-1)    // Check if it is in the last column
                     {
                         os << "\t";
                     }
@@ -0,0 +1,354 @@
+/*
+ * csv_cursor.hpp
+ * 
+ * Copyright (C) 2020, Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ * 
+ * This file is part of CEST library.
+ * 
+ * CEST library is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * CEST library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with CEST library. If not, see <http://www.gnu.org/licenses/>.
+ * 
+ */
+
+/**
+ * \brief Streaming CSV row cursor.
+ * 
+ * \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ * 
+ * \version 0.1.0
+ * 
+ * \date 18/10/2026
+ * 
+ * \addtogroup csv
+ * \{
+ */
+
+#ifndef CSV_CURSOR_H_
+#define CSV_CURSOR_H_
+
+#include <string>
+#include <vector>
+#include <cstdio>
+#include <cstring>
+#include <algorithm>
+#include <stdexcept>
+
+#include "csv.hpp"
+
+#define CSV_CURSOR_DEFAULT_BUFFER_SIZE      (1 << 16)   /**< Default read buffer size in bytes. */
+
+/**
+ * \brief Forward-only CSV reader that parses one row at a time.
+ *
+ * The file is read in fixed-size blocks and each row is parsed into a fixed-size array of cells, so the memory usage
+ * does not depend on the size of the file (the read buffer only grows if a single line does not fit in it). Short rows
+ * are completed with empty cells, empty lines are ignored, and a row with more than MAX_COLS cells is an error.
+ *
+ * Usage:
+ * \code
+ * CSVRowCursor<unsigned int, 3> cursor("star_pixels.csv");
+ *
+ * while(cursor.Next())
+ * {
+ *     StarPixel(cursor[0], cursor[1], cursor[2]);
+ * }
+ * \endcode
+ */
+template <class TCell, unsigned int MAX_COLS>
+class CSVRowCursor
+{
+    private:
+
+        FILE *file;                 /**< Input file (NULL if no file is open). */
+
+        std::vector<char> buffer;   /**< Read buffer (always terminated by a null character). */
+
+        size_t pos;                 /**< Position of the next line in the buffer. */
+
+        size_t len;                 /**< Number of valid bytes in the buffer. */
+
+        bool eof;                   /**< True if the end of the file was reached. */
+
+        TCell cells[MAX_COLS];      /**< Cells of the current row. */
+
+        unsigned int cols;          /**< Number of cells of the current row. */
+
+        unsigned long long row;     /**< Number of rows read so far. */
+
+        /**
+         * \brief Reads the next block of the file, keeping the unread bytes of the buffer.
+         *
+         * \return None.
+         */
+        void Refill()
+        {
+            // The unread bytes are moved to the beginning of the buffer
+            if (this->pos > 0)
+            {
+                memmove(this->buffer.data(), this->buffer.data() + this->pos, this->len - this->pos);
+
+                this->len -= this->pos;
+                this->pos = 0;
+            }
+
+            // A line longer than the buffer
+            if (this->len + 1 == this->buffer.size())
+            {
+                this->buffer.resize(this->buffer.size()*2);
+            }
+
+            size_t n = fread(this->buffer.data() + this->len, 1, this->buffer.size() - this->len - 1, this->file);
+
+            if (n == 0)
+            {
+                if (ferror(this->file))
+                {
+                    throw std::runtime_error("Error reading the input file in " + std::string(__func__) + " method from " + __FILE__ + " file!");
+                }
+
+                this->eof = true;
+            }
+
+            this->len += n;
+
+            this->buffer[this->len] = '\0';
+        }
+
+        /**
+         * \brief Parses a line into the cells of the current row.
+         *
+         * \param[in] begin is the first character of the line.
+         *
+         * \param[in] end is the end of the line (without the new line characters).
+         *
+         * \return None.
+         */
+        void ParseLine(const char *begin, const char *end)
+        {
+            this->cols = 0;
+
+            const char *cell = begin;
+
+            while(cell <= end)
+            {
+                const char *cell_end = cell;
+
+                while((cell_end < end) and (*cell_end != ','))
+                {
+                    cell_end++;
+                }
+
+                if (this->cols == MAX_COLS)
+                {
+                    throw std::runtime_error("Error reading the input file in " + std::string(__func__) + " method from " + __FILE__ + " file: Too many columns in row " + std::to_string(this->row) + "!");
+                }
+
+                CSVCell<TCell>::Parse(cell, cell_end, this->cells[this->cols++]);
+
+                cell = cell_end + 1;
+            }
+
+            for(unsigned int i=this->cols; i<MAX_COLS; i++)
+            {
+                this->cells[i] = TCell();
+            }
+        }
+
+    public:
+
+        /**
+         * \brief Class constructor without a file.
+         *
+         * \param[in] buffer_size is the initial size of the read buffer in bytes.
+         *
+         * \return None.
+         */
+        CSVRowCursor(size_t buffer_size=CSV_CURSOR_DEFAULT_BUFFER_SIZE)
+            : buffer(std::max<size_t>(buffer_size, 2))
+        {
+            this->file  = NULL;
+            this->pos   = 0;
+            this->len   = 0;
+            this->eof   = true;
+            this->cols  = 0;
+            this->row   = 0;
+        }
+
+        /**
+         * \brief Class constructor with a file.
+         *
+         * \param[in] in_file is the CSV file to read.
+         *
+         * \param[in] buffer_size is the initial size of the read buffer in bytes.
+         *
+         * \return None.
+         */
+        CSVRowCursor(const char *in_file, size_t buffer_size=CSV_CURSOR_DEFAULT_BUFFER_SIZE)
+            : CSVRowCursor(buffer_size)
+        {
+            this->Open(in_file);
+        }
+
+        /**
+         * \brief Class destructor.
+         *
+         * \return None.
+         */
+        ~CSVRowCursor()
+        {
+            this->Close();
+        }
+
+        /**
+         * \brief Opens a CSV file (the cursor is placed before the first row).
+         *
+         * \param[in] in_file is the CSV file to read.
+         *
+         * \return None.
+         */
+        void Open(const char *in_file)
+        {
+            this->Close();
+
+            this->file = fopen(in_file, "rb");
+
+            if (!this->file)
+            {
+                throw std::runtime_error("Error openning the input file in " + std::string(__func__) + " method from " + __FILE__ + " file!");
+            }
+
+            this->eof = false;
+        }
+
+        /**
+         * \brief Closes the current file.
+         *
+         * \return None.
+         */
+        void Close()
+        {
+            if (this->file)
+            {
+                fclose(this->file);
+
+                this->file = NULL;
+            }
+
+            this->pos   = 0;
+            this->len   = 0;
+            this->eof   = true;
+            this->cols  = 0;
+            this->row   = 0;
+        }
+
+        /**
+         * \brief Moves the cursor to the next row.
+         *
+         * \return True if a new row was read, or false at the end of the file.
+         */
+        bool Next()
+        {
+            while(true)
+            {
+                char *begin = this->buffer.data() + this->pos;
+                char *eol = static_cast<char*>(memchr(begin, '\n', this->len - this->pos));
+
+                if (!eol)
+                {
+                    if (!this->eof)
+                    {
+                        this->Refill();
+
+                        continue;
+                    }
+
+                    // Last line without a new line character
+                    if (this->pos == this->len)
+                    {
+                        return false;
+                    }
+
+                    eol = this->buffer.data() + this->len;
+                }
+
+                this->pos = eol - this->buffer.data() + (eol < this->buffer.data() + this->len ? 1 : 0);
+
+                const char *line_end = ((eol > begin) and (eol[-1] == '\r')) ? eol - 1 : eol;
+
+                if (line_end > begin)
+                {
+                    this->ParseLine(begin, line_end);
+
+                    this->row++;
+
+                    return true;
+                }
+            }
+        }
+
+        /**
+         * \brief Returns the number of cells of the current row.
+         *
+         * \return The number of cells of the current row.
+         */
+        unsigned int GetColumns()
+        {
+            return this->cols;
+        }
+
+        /**
+         * \brief Returns the number of rows read so far.
+         *
+         * \return The number of rows read so far.
+         */
+        unsigned long long GetRow()
+        {
+            return this->row;
+        }
+
+        /**
+         * \brief Reads a cell of the current row.
+         *
+         * \param[in] col is the column of the cell (empty cells and columns after the end of the row are read as
+         * TCell()).
+         *
+         * \return The given cell content.
+         */
+        TCell ReadCell(unsigned int col)
+        {
+            if (col < MAX_COLS)
+            {
+                return this->cells[col];
+            }
+            else
+            {
+                throw std::range_error("Error reading a cell in " + std::string(__func__) + " method from " + __FILE__ + " file: This cell does not exist!");
+            }
+        }
+
+        /**
+         * \brief Reads a cell of the current row (without bounds checking).
+         *
+         * \param[in] col is the column of the cell (it must be less than MAX_COLS).
+         *
+         * \return The given cell content.
+         */
+        const TCell& operator[](unsigned int col) const
+        {
+            return this->cells[col];
+        }
+};
+
+#endif // CSV_CURSOR_H_
+
+//! \} End of csv group
@@ -0,0 +1,300 @@
+/*
+ * csv_writer.h
+ * 
+ * Copyright (C) 2020, Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ * 
+ * This file is part of CEST library.
+ * 
+ * CEST library is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * CEST library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with CEST library. If not, see <http://www.gnu.org/licenses/>.
+ * 
+ */
+
+/**
+ * \brief Buffered CSV writer definition.
+ * 
+ * \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ * 
+ * \version 0.1.0
+ * 
+ * \date 18/10/2026
+ * 
+ * \defgroup csv-writer CSV Writer
+ * \ingroup cest
+ * \{
+ */
+
+#ifndef CSV_WRITER_H_
+#define CSV_WRITER_H_
+
+#include <string>
+#include <vector>
+#include <sstream>
+#include <cstdio>
+#include <cstddef>
+
+#define CSV_WRITER_DEFAULT_BUFFER_SIZE      (1 << 20)   /**< Default buffer size in bytes. */
+#define CSV_WRITER_DEFAULT_PRECISION        6           /**< Default number of decimal places of the floating-point cells. */
+#define CSV_WRITER_MAX_CELL_LENGTH          64          /**< Maximum length of a formatted number. */
+
+/**
+ * \brief A CSV file writer with a user-space buffer.
+ *
+ * The cells are formatted directly in a large buffer, which is only written to the file when it is full (or when the
+ * file is flushed or closed). The integers are formatted digit by digit, and the floating-point values are formatted
+ * with a fixed number of decimal places (the trailing zeros are removed).
+ */
+class CSVWriter
+{
+    private:
+
+        /**
+         * \brief Output file (NULL if no file is open).
+         */
+        FILE *file;
+
+        /**
+         * \brief Output buffer.
+         */
+        std::vector<char> buffer;
+
+        /**
+         * \brief Number of bytes in the buffer.
+         */
+        size_t pos;
+
+        /**
+         * \brief Number of decimal places of the floating-point cells.
+         */
+        unsigned int precision;
+
+        /**
+         * \brief True if the next cell is the first of a row.
+         */
+        bool row_start;
+
+        /**
+         * \brief Makes room in the buffer for a new cell and writes the column separator (if needed).
+         *
+         * \return None.
+         */
+        void BeginCell();
+
+        /**
+         * \brief Formats an unsigned integer in the buffer.
+         *
+         * \param[in] val is the value to format.
+         *
+         * \return None.
+         */
+        void FormatUnsigned(unsigned long long val);
+
+    public:
+
+        /**
+         * \brief Class constructor.
+         *
+         * \param[in] buffer_size is the size of the output buffer in bytes.
+         *
+         * \return None.
+         */
+        CSVWriter(size_t buffer_size=CSV_WRITER_DEFAULT_BUFFER_SIZE);
+
+        /**
+         * \brief Class constructor with a file.
+         *
+         * \param[in] file_name is the file to write (it is truncated).
+         *
+         * \param[in] buffer_size is the size of the output buffer in bytes.
+         *
+         * \return None.
+         */
+        CSVWriter(const std::string &file_name, size_t buffer_size=CSV_WRITER_DEFAULT_BUFFER_SIZE);
+
+        /**
+         * \brief Class destructor (the file is closed).
+         *
+         * \return None.
+         */
+        ~CSVWriter();
+
+        /**
+         * \brief Opens a file to write (the current file is closed).
+         *
+         * \param[in] file_name is the file to write.
+         *
+         * \param[in] append is true to append the new rows to the file, or false to truncate it.
+         *
+         * \return None.
+         */
+        void Open(const std::string &file_name, bool append=false);
+
+        /**
+         * \brief Writes the buffer to the file and closes it.
+         *
+         * \return None.
+         */
+        void Close();
+
+        /**
+         * \brief Writes the buffer to the file.
+         *
+         * \return None.
+         */
+        void Flush();
+
+        /**
+         * \brief Sets the number of decimal places of the floating-point cells.
+         *
+         * \param[in] p is the new number of decimal places (up to 9).
+         *
+         * \return None.
+         */
+        void SetPrecision(unsigned int p);
+
+        /**
+         * \brief Writes an integer cell.
+         *
+         * \param[in] val is the value of the cell.
+         *
+         * \return None.
+         */
+        void WriteCell(long long val);
+
+        /**
+         * \brief Writes an unsigned integer cell.
+         *
+         * \param[in] val is the value of the cell.
+         *
+         * \return None.
+         */
+        void WriteCell(unsigned long long val);
+
+        /**
+         * \brief Writes an integer cell (overloaded).
+         *
+         * \param[in] val is the value of the cell.
+         *
+         * \return None.
+         */
+        void WriteCell(int val)                 { this->WriteCell((long long)val); }
+
+        /**
+         * \brief Writes an unsigned integer cell (overloaded).
+         *
+         * \param[in] val is the value of the cell.
+         *
+         * \return None.
+         */
+        void WriteCell(unsigned int val)        { this->WriteCell((unsigned long long)val); }
+
+        /**
+         * \brief Writes an integer cell (overloaded).
+         *
+         * \param[in] val is the value of the cell.
+         *
+         * \return None.
+         */
+        void WriteCell(long val)                { this->WriteCell((long long)val); }
+
+        /**
+         * \brief Writes an unsigned integer cell (overloaded).
+         *
+         * \param[in] val is the value of the cell.
+         *
+         * \return None.
+         */
+        void WriteCell(unsigned long val)       { this->WriteCell((unsigned long long)val); }
+
+        /**
+         * \brief Writes a floating-point cell.
+         *
+         * \param[in] val is the value of the cell.
+         *
+         * \return None.
+         */
+        void WriteCell(double val);
+
+        /**
+         * \brief Writes a floating-point cell (overloaded).
+         *
+         * \param[in] val is the value of the cell.
+         *
+         * \return None.
+         */
+        void WriteCell(float val)               { this->WriteCell((double)val); }
+
+        /**
+         * \brief Writes a text cell (it is not quoted).
+         *
+         * \param[in] val is the value of the cell.
+         *
+         * \return None.
+         */
+        void WriteCell(const std::string &val);
+
+        /**
+         * \brief Writes a text cell (overloaded).
+         *
+         * \param[in] val is the value of the cell.
+         *
+         * \return None.
+         */
+        void WriteCell(const char *val)         { this->WriteCell(std::string(val)); }
+
+        /**
+         * \brief Writes a cell of any other type (formatted with a stringstream).
+         *
+         * \param[in] val is the value of the cell.
+         *
+         * \return None.
+         */
+        template<class T>
+        void WriteCell(const T &val)
+        {
+            std::ostringstream convert;
+
+            convert << val;
+
+            this->WriteCell(convert.str());
+        }
+
+        /**
+         * \brief Ends the current row.
+         *
+         * \return None.
+         */
+        void EndRow();
+
+        /**
+         * \brief Writes a full row.
+         *
+         * \param[in] row is the list of cells of the row.
+         *
+         * \return None.
+         */
+        template<class T>
+        void WriteRow(const std::vector<T> &row)
+        {
+            for(size_t i=0; i<row.size(); i++)
+            {
+                this->WriteCell(row[i]);
+            }
+
+            this->EndRow();
+        }
+};
+
+#endif // CSV_WRITER_H_
+
+//! \} End of csv-writer group
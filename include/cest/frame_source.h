@@ -0,0 +1,201 @@
+/*
+ * frame_source.h
+ * 
+ * Copyright (C) 2020, Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ * 
+ * This file is part of CEST library.
+ * 
+ * CEST library is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * CEST library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with CEST library. If not, see <http://www.gnu.org/licenses/>.
+ * 
+ */
+
+/**
+ * \brief Frame source definition.
+ * 
+ * \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ * 
+ * \version 0.1.0
+ * 
+ * \date 18/10/2026
+ * 
+ * \defgroup frame-source Frame Source
+ * \ingroup cest
+ * \{
+ */
+
+#ifndef FRAME_SOURCE_H_
+#define FRAME_SOURCE_H_
+
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <exception>
+#include <opencv2/opencv.hpp>
+
+#define FRAME_SOURCE_DEFAULT_PREFETCH       4       /**< Default number of frames decoded ahead. */
+
+/**
+ * \brief A sequence of frames decoded ahead in a background thread.
+ *
+ * The frames are decoded by the prefetch thread into a bounded ring of buffers, while the calling thread processes the
+ * previous frames. The buffers are reused: each call to Next() gives the buffer of the caller back to the ring (to be
+ * filled with a future frame), so a frame must be cloned if it is needed after the next call to Next().
+ *
+ * The derived classes implement the ReadFrame method and must call StopPrefetch() in their destructors (before their
+ * own members are destroyed).
+ */
+class FrameSource
+{
+    private:
+
+        /**
+         * \brief Frame buffers.
+         */
+        std::vector<cv::Mat> ring;
+
+        /**
+         * \brief Index of the next buffer to be filled by the prefetch thread.
+         */
+        unsigned int head;
+
+        /**
+         * \brief Index of the next buffer to be read by the calling thread.
+         */
+        unsigned int tail;
+
+        /**
+         * \brief Number of decoded frames in the ring.
+         */
+        unsigned int count;
+
+        /**
+         * \brief Number of frames returned by the Next method.
+         */
+        unsigned long frames;
+
+        /**
+         * \brief Prefetch thread.
+         */
+        std::thread prefetcher;
+
+        /**
+         * \brief Mutex to protect the ring state.
+         */
+        std::mutex ring_mutex;
+
+        /**
+         * \brief Signalizes the calling thread that a new frame was decoded (or that the sequence ended).
+         */
+        std::condition_variable not_empty;
+
+        /**
+         * \brief Signalizes the prefetch thread that a buffer was released.
+         */
+        std::condition_variable not_full;
+
+        /**
+         * \brief True if the prefetch thread was started.
+         */
+        bool started;
+
+        /**
+         * \brief Flag to stop the prefetch thread.
+         */
+        bool stop;
+
+        /**
+         * \brief True if the prefetch thread reached the end of the sequence (or an error).
+         */
+        bool finished;
+
+        /**
+         * \brief Error of the prefetch thread (rethrown by the Next method).
+         */
+        std::exception_ptr error;
+
+        /**
+         * \brief Prefetch thread loop.
+         *
+         * \return None.
+         */
+        void Prefetch();
+
+    protected:
+
+        /**
+         * \brief Decodes the next frame of the sequence (called from the prefetch thread).
+         *
+         * \param[in,out] frame is the buffer to decode the frame into (it should be reused if it has the right size and
+         * type).
+         *
+         * \return True if a frame was decoded, or false at the end of the sequence.
+         */
+        virtual bool ReadFrame(cv::Mat &frame) = 0;
+
+        /**
+         * \brief Stops the prefetch thread and discards the decoded frames.
+         *
+         * \return None.
+         */
+        void StopPrefetch();
+
+    public:
+
+        /**
+         * \brief Class constructor.
+         *
+         * \param[in] prefetch is the number of frames decoded ahead (the size of the ring).
+         *
+         * \return None.
+         */
+        FrameSource(unsigned int prefetch=FRAME_SOURCE_DEFAULT_PREFETCH);
+
+        /**
+         * \brief Class destructor.
+         *
+         * \return None.
+         */
+        virtual ~FrameSource();
+
+        /**
+         * \brief Gets the next frame of the sequence.
+         *
+         * The prefetch thread is started in the first call. An error of the prefetch thread is thrown after the frames
+         * decoded before it.
+         *
+         * \param[in,out] frame receives the next frame (its previous buffer is reused for a future frame).
+         *
+         * \return True if a frame was read, or false at the end of the sequence.
+         */
+        bool Next(cv::Mat &frame);
+
+        /**
+         * \brief Gets the number of frames read so far.
+         *
+         * \return The number of frames returned by the Next method.
+         */
+        unsigned long GetFrameIndex();
+
+        /**
+         * \brief Gets the number of frames of the sequence.
+         *
+         * \return The number of frames, or -1 if it is not known.
+         */
+        virtual long GetNumberOfFrames() = 0;
+};
+
+#endif // FRAME_SOURCE_H_
+
+//! \} End of frame-source group
@@ -0,0 +1,130 @@
+/*
+ * frame_source_dir.h
+ * 
+ * Copyright (C) 2020, Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ * 
+ * This file is part of CEST library.
+ * 
+ * CEST library is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * CEST library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with CEST library. If not, see <http://www.gnu.org/licenses/>.
+ * 
+ */
+
+/**
+ * \brief Frame source (image directory) definition.
+ * 
+ * \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ * 
+ * \version 0.1.0
+ * 
+ * \date 18/10/2026
+ * 
+ * \defgroup frame-source-dir Frame Source (Directory)
+ * \ingroup frame-source
+ * \{
+ */
+
+#ifndef FRAME_SOURCE_DIR_H_
+#define FRAME_SOURCE_DIR_H_
+
+#include <string>
+#include <vector>
+#include <opencv2/opencv.hpp>
+
+#include "frame_source.h"
+
+/**
+ * \brief The images of a directory as a sequence of frames (in the order of the file names).
+ *
+ * 8-bit binary PGM files are read with the MappedFrame class (without decoding), and the other files (including ASCII
+ * and 16-bit PNM files) with cv::imread().
+ */
+class FrameSourceDir: public FrameSource
+{
+    private:
+
+        /**
+         * \brief Image files of the sequence.
+         */
+        std::vector<std::string> files;
+
+        /**
+         * \brief Index of the next file to read.
+         */
+        size_t next_file;
+
+        /**
+         * \brief cv::imread() flags.
+         */
+        int flags;
+
+    protected:
+
+        /**
+         * \brief Reads the next image of the directory.
+         *
+         * \param[in,out] frame is the buffer to decode the image into.
+         *
+         * \return True if an image was read, or false after the last file.
+         */
+        bool ReadFrame(cv::Mat &frame);
+
+    public:
+
+        /**
+         * \brief Class constructor.
+         *
+         * \param[in] dir is the directory of the images.
+         *
+         * \param[in] flags are the cv::imread() flags.
+         *
+         * \param[in] prefetch is the number of frames decoded ahead.
+         *
+         * \return None.
+         */
+        FrameSourceDir(const std::string &dir, int flags=cv::IMREAD_GRAYSCALE, unsigned int prefetch=FRAME_SOURCE_DEFAULT_PREFETCH);
+
+        /**
+         * \brief Class destructor.
+         *
+         * \return None.
+         */
+        ~FrameSourceDir();
+
+        /**
+         * \brief Opens a new directory (the sequence restarts).
+         *
+         * \param[in] dir is the directory of the images.
+         *
+         * \return None.
+         */
+        void Open(const std::string &dir);
+
+        /**
+         * \brief Gets the image files of the sequence.
+         *
+         * \return The list of files, sorted by name.
+         */
+        std::vector<std::string> GetFiles();
+
+        /**
+         * \brief Gets the number of frames of the sequence.
+         *
+         * \return The number of files of the directory.
+         */
+        long GetNumberOfFrames();
+};
+
+#endif // FRAME_SOURCE_DIR_H_
+
+//! \} End of frame-source-dir group
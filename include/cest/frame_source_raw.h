@@ -0,0 +1,151 @@
+/*
+ * frame_source_raw.h
+ * 
+ * Copyright (C) 2020, Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ * 
+ * This file is part of CEST library.
+ * 
+ * CEST library is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * CEST library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with CEST library. If not, see <http://www.gnu.org/licenses/>.
+ * 
+ */
+
+/**
+ * \brief Frame source (raw multi-frame file) definition.
+ * 
+ * \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ * 
+ * \version 0.1.0
+ * 
+ * \date 18/10/2026
+ * 
+ * \defgroup frame-source-raw Frame Source (Raw)
+ * \ingroup frame-source
+ * \{
+ */
+
+#ifndef FRAME_SOURCE_RAW_H_
+#define FRAME_SOURCE_RAW_H_
+
+#include <string>
+#include <cstdio>
+#include <opencv2/opencv.hpp>
+
+#include "frame_source.h"
+
+/**
+ * \brief The frames of a raw sensor recording.
+ *
+ * The file is a sequence of frames without headers, each one in the format written by StarFilterHW::WriteRawImage (the
+ * pixels row by row, with the 16-bit pixels in the host byte order). An incomplete frame at the end of the file is
+ * ignored.
+ */
+class FrameSourceRaw: public FrameSource
+{
+    private:
+
+        /**
+         * \brief Input file (NULL if no file is open).
+         */
+        FILE *file;
+
+        /**
+         * \brief Frame width.
+         */
+        int width;
+
+        /**
+         * \brief Frame height.
+         */
+        int height;
+
+        /**
+         * \brief Frame type (CV_8UC1 or CV_16UC1).
+         */
+        int type;
+
+        /**
+         * \brief Number of complete frames of the file.
+         */
+        long frames;
+
+        /**
+         * \brief Closes the input file.
+         *
+         * \return None.
+         */
+        void CloseFile();
+
+    protected:
+
+        /**
+         * \brief Reads the next frame of the file.
+         *
+         * \param[in,out] frame is the buffer to read the frame into.
+         *
+         * \return True if a frame was read, or false at the end of the file.
+         */
+        bool ReadFrame(cv::Mat &frame);
+
+    public:
+
+        /**
+         * \brief Class constructor.
+         *
+         * \param[in] file is the raw file.
+         *
+         * \param[in] width is the frame width.
+         *
+         * \param[in] height is the frame height.
+         *
+         * \param[in] type is the frame type (CV_8UC1 or CV_16UC1).
+         *
+         * \param[in] prefetch is the number of frames read ahead.
+         *
+         * \return None.
+         */
+        FrameSourceRaw(const std::string &file, int width, int height, int type=CV_8UC1, unsigned int prefetch=FRAME_SOURCE_DEFAULT_PREFETCH);
+
+        /**
+         * \brief Class destructor.
+         *
+         * \return None.
+         */
+        ~FrameSourceRaw();
+
+        /**
+         * \brief Opens a new raw file (the sequence restarts).
+         *
+         * \param[in] file is the raw file.
+         *
+         * \param[in] width is the frame width.
+         *
+         * \param[in] height is the frame height.
+         *
+         * \param[in] type is the frame type (CV_8UC1 or CV_16UC1).
+         *
+         * \return None.
+         */
+        void Open(const std::string &file, int width, int height, int type=CV_8UC1);
+
+        /**
+         * \brief Gets the number of frames of the sequence.
+         *
+         * \return The number of complete frames of the file.
+         */
+        long GetNumberOfFrames();
+};
+
+#endif // FRAME_SOURCE_RAW_H_
+
+//! \} End of frame-source-raw group
@@ -0,0 +1,114 @@
+/*
+ * frame_source_video.h
+ * 
+ * Copyright (C) 2020, Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ * 
+ * This file is part of CEST library.
+ * 
+ * CEST library is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * CEST library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with CEST library. If not, see <http://www.gnu.org/licenses/>.
+ * 
+ */
+
+/**
+ * \brief Frame source (video) definition.
+ * 
+ * \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ * 
+ * \version 0.1.0
+ * 
+ * \date 18/10/2026
+ * 
+ * \defgroup frame-source-video Frame Source (Video)
+ * \ingroup frame-source
+ * \{
+ */
+
+#ifndef FRAME_SOURCE_VIDEO_H_
+#define FRAME_SOURCE_VIDEO_H_
+
+#include <string>
+#include <opencv2/opencv.hpp>
+
+#include "frame_source.h"
+
+/**
+ * \brief The frames of a video file or camera (read with cv::VideoCapture).
+ *
+ * The frames are returned as decoded by OpenCV (usually BGR images, whose green channel is used by the star filters).
+ */
+class FrameSourceVideo: public FrameSource
+{
+    private:
+
+        /**
+         * \brief Video capture (only used by the prefetch thread after the sequence starts).
+         */
+        cv::VideoCapture capture;
+
+        /**
+         * \brief Number of frames reported by the video (-1 if unknown).
+         */
+        long frames;
+
+    protected:
+
+        /**
+         * \brief Decodes the next frame of the video.
+         *
+         * \param[in,out] frame is the buffer to decode the frame into.
+         *
+         * \return True if a frame was decoded, or false at the end of the video.
+         */
+        bool ReadFrame(cv::Mat &frame);
+
+    public:
+
+        /**
+         * \brief Class constructor.
+         *
+         * \param[in] source is a video file, a stream URL or a camera index (as a number).
+         *
+         * \param[in] prefetch is the number of frames decoded ahead.
+         *
+         * \return None.
+         */
+        FrameSourceVideo(const std::string &source, unsigned int prefetch=FRAME_SOURCE_DEFAULT_PREFETCH);
+
+        /**
+         * \brief Class destructor.
+         *
+         * \return None.
+         */
+        ~FrameSourceVideo();
+
+        /**
+         * \brief Opens a new video (the sequence restarts).
+         *
+         * \param[in] source is a video file, a stream URL or a camera index (as a number).
+         *
+         * \return None.
+         */
+        void Open(const std::string &source);
+
+        /**
+         * \brief Gets the number of frames of the sequence.
+         *
+         * \return The number of frames reported by the video, or -1 if it is not known (cameras and streams).
+         */
+        long GetNumberOfFrames();
+};
+
+#endif // FRAME_SOURCE_VIDEO_H_
+
+//! \} End of frame-source-video group
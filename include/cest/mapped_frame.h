@@ -0,0 +1,208 @@
+/*
+ * mapped_frame.h
+ * 
+ * Copyright (C) 2020, Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ * 
+ * This file is part of CEST library.
+ * 
+ * CEST library is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * CEST library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with CEST library. If not, see <http://www.gnu.org/licenses/>.
+ * 
+ */
+
+/**
+ * \brief Memory-mapped frame definition.
+ * 
+ * \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ * 
+ * \version 0.1.0
+ * 
+ * \date 18/10/2026
+ * 
+ * \defgroup mapped-frame Mapped Frame
+ * \ingroup cest
+ * \{
+ */
+
+#ifndef MAPPED_FRAME_H_
+#define MAPPED_FRAME_H_
+
+#include <string>
+#include <cstddef>
+#include <opencv2/opencv.hpp>
+
+#define MAPPED_FRAME_MAX_HEADER_LENGTH      1024    /**< Maximum length of a PNM header in bytes. */
+
+/**
+ * \brief A frame file mapped in memory.
+ *
+ * The file is mapped with mmap() and the returned image is a cv::Mat header pointing to the mapped pixels, so no decoding
+ * or copy is done (the pages are only read from the disk when the pixels are accessed). The supported files are:
+ *
+ * - Binary PGM files (P5) with 8-bit pixels.
+ * - Binary PPM files (P6) with 8-bit pixels. The channels are in the file order (RGB), and the star filters use only
+ *   the green channel, which is the same in the RGB and BGR orders.
+ * - Raw sensor dumps (as written by StarFilterHW::WriteRawImage): the pixels without a header, row by row, with a
+ *   given size and type.
+ *
+ * 16-bit PNM files are big-endian, so they are converted to a regular (owned) image.
+ *
+ * The mapping is private: writing to the image does not change the file.
+ */
+class MappedFrame
+{
+    private:
+
+        /**
+         * \brief Mapped file (NULL if no file is mapped).
+         */
+        void *map;
+
+        /**
+         * \brief Mapped file length in bytes.
+         */
+        size_t map_len;
+
+        /**
+         * \brief Frame image (points to the mapped file or to its own buffer).
+         */
+        cv::Mat frame;
+
+        /**
+         * \brief Maps a file in memory.
+         *
+         * \param[in] file is the file to map.
+         *
+         * \return None.
+         */
+        void Map(const std::string &file);
+
+        /**
+         * \brief Parses the header of a binary PNM file.
+         *
+         * \param[in] data is the start of the file.
+         *
+         * \param[in] len is the length of the data in bytes.
+         *
+         * \param[out] width is the image width.
+         *
+         * \param[out] height is the image height.
+         *
+         * \param[out] max_val is the maximum pixel value.
+         *
+         * \param[out] channels is the number of channels (1 for P5 and 3 for P6).
+         *
+         * \return The offset of the first pixel in the file, or 0 if the data is not a valid binary PGM or PPM header.
+         */
+        static size_t ParsePNMHeader(const char *data, size_t len, int &width, int &height, int &max_val, int &channels);
+
+    public:
+
+        /**
+         * \brief Class constructor.
+         *
+         * \return None.
+         */
+        MappedFrame();
+
+        /**
+         * \brief Class constructor with a PNM file.
+         *
+         * \param[in] file is the PGM or PPM file to map.
+         *
+         * \return None.
+         */
+        MappedFrame(const std::string &file);
+
+        /**
+         * \brief Class destructor.
+         *
+         * \return None.
+         */
+        ~MappedFrame();
+
+        /**
+         * \brief The object owns a memory mapping, so it cannot be copied.
+         */
+        MappedFrame(const MappedFrame&) = delete;
+
+        /**
+         * \brief The object owns a memory mapping, so it cannot be copied.
+         */
+        MappedFrame& operator=(const MappedFrame&) = delete;
+
+        /**
+         * \brief Maps a binary PGM (P5) or PPM (P6) file (the current file is unmapped).
+         *
+         * \param[in] file is the PGM or PPM file to map.
+         *
+         * \return None.
+         */
+        void Open(const std::string &file);
+
+        /**
+         * \brief Maps a raw sensor dump (the current file is unmapped).
+         *
+         * \param[in] file is the raw file to map.
+         *
+         * \param[in] width is the image width.
+         *
+         * \param[in] height is the image height.
+         *
+         * \param[in] type is the image type (CV_8UC1 or CV_16UC1, with the 16-bit pixels in the host byte order).
+         *
+         * \return None.
+         */
+        void OpenRaw(const std::string &file, int width, int height, int type=CV_8UC1);
+
+        /**
+         * \brief Unmaps the current file.
+         *
+         * \return None.
+         */
+        void Close();
+
+        /**
+         * \brief Gets the frame image.
+         *
+         * The returned image does not own the mapped pixels, so it (and its copies and ROIs) must not be used after the
+         * file is unmapped (by the Close, Open or OpenRaw methods, or by the destructor). Use cv::Mat::clone() to keep
+         * the pixels.
+         *
+         * \return An image pointing to the mapped pixels, or an empty image if no file is mapped.
+         */
+        cv::Mat GetImage() const;
+
+        /**
+         * \brief Checks if a file is supported by the Open method (by its extension).
+         *
+         * \param[in] file is the file name.
+         *
+         * \return True if the file is a PGM, PPM or PNM file.
+         */
+        static bool IsPNM(const std::string &file);
+
+        /**
+         * \brief Gets the image type of a PNM file from its header (without mapping the file).
+         *
+         * \param[in] file is the file name.
+         *
+         * \return The type of the image returned by the Open method (CV_8UC1, CV_8UC3, CV_16UC1 or CV_16UC3), or -1 if the
+         * file cannot be read or is not a binary PGM or PPM file (as the ASCII P2 and P3 files).
+         */
+        static int GetPNMType(const std::string &file);
+};
+
+#endif // MAPPED_FRAME_H_
+
+//! \} End of mapped-frame group
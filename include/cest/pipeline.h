@@ -0,0 +1,240 @@
+/*
+ * pipeline.h
+ * 
+ * Copyright (C) 2020, Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ * 
+ * This file is part of CEST library.
+ * 
+ * CEST library is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * CEST library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with CEST library. If not, see <http://www.gnu.org/licenses/>.
+ * 
+ */
+
+/**
+ * \brief Frame processing pipeline definition.
+ * 
+ * \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ * 
+ * \version 0.1.0
+ * 
+ * \date 18/10/2026
+ * 
+ * \defgroup pipeline Pipeline
+ * \ingroup cest
+ * \{
+ */
+
+#ifndef PIPELINE_H_
+#define PIPELINE_H_
+
+#include <vector>
+#include <atomic>
+#include <mutex>
+#include <exception>
+#include <functional>
+#include <opencv2/opencv.hpp>
+
+#include "star_pixel.hpp"
+#include "centroid.hpp"
+#include "star_filter.h"
+#include "centroider.h"
+#include "frame_source.h"
+#include "spsc_queue.hpp"
+
+#define PIPELINE_DEFAULT_DEPTH      4       /**< Default number of frames in flight (one per stage). */
+#define PIPELINE_MIN_DEPTH          2       /**< Minimum number of frames in flight (double buffering). */
+
+/**
+ * \brief A frame in the pipeline, with the results of each stage.
+ */
+struct PipelineFrame
+{
+    unsigned long index;                        /**< Frame index in the sequence. */
+    cv::Mat image;                              /**< Frame image. */
+    std::vector<cest::StarPixel> star_pixels;   /**< Star pixels of the frame. */
+    std::vector<cest::Centroid> centroids;      /**< Centroids of the frame (sorted by brightness if enabled). */
+};
+
+/**
+ * \brief Runs the processing stages of a frame sequence in parallel threads.
+ *
+ * The stages are the frame acquisition, the star filter, the centroider and the output (a user function called in the
+ * calling thread), each one in its own thread and connected by lock-free SPSC queues. A fixed set of frames (with their
+ * image, star pixel and centroid buffers) circulates through the stages, so frame N+1 is filtered while frame N is
+ * centroided, and no memory is allocated once the buffers are large enough. The throughput is limited by the slowest
+ * stage, and the frames reach the output in the sequence order.
+ *
+ * The star filter and the centroider are only used by their stage threads during Run().
+ */
+class Pipeline
+{
+    private:
+
+        /**
+         * \brief Star filter of the filter stage.
+         */
+        StarFilter *star_filter;
+
+        /**
+         * \brief Centroider of the centroider stage.
+         */
+        Centroider *centroider;
+
+        /**
+         * \brief Correction factor of the centroider.
+         */
+        float correction_factor;
+
+        /**
+         * \brief True to sort the centroids by brightness.
+         */
+        bool sort_centroids;
+
+        /**
+         * \brief Number of frames in flight.
+         */
+        unsigned int depth;
+
+        /**
+         * \brief Flag to stop all the stages (set after an error).
+         */
+        std::atomic<bool> abort;
+
+        /**
+         * \brief Mutex to protect the error.
+         */
+        std::mutex error_mutex;
+
+        /**
+         * \brief First error of the stages (rethrown by the Run method).
+         */
+        std::exception_ptr error;
+
+        /**
+         * \brief Frame queue type.
+         */
+        typedef SPSCQueue<PipelineFrame*> FrameQueue;
+
+        /**
+         * \brief Stores the current exception and stops all the stages.
+         *
+         * \return None.
+         */
+        void Fail();
+
+        /**
+         * \brief Waits for a frame from a queue.
+         *
+         * \param[in] queue is the queue to read.
+         *
+         * \param[out] frame receives the frame (NULL at the end of the sequence).
+         *
+         * \return True if a frame (or the end of the sequence) was read, or false if the pipeline was stopped.
+         */
+        bool WaitFrame(FrameQueue &queue, PipelineFrame *&frame);
+
+        /**
+         * \brief Acquisition stage: reads the frames of the source into the free frame buffers.
+         *
+         * \param[in] source is the frame source.
+         *
+         * \param[in] in is the queue of free frames.
+         *
+         * \param[in] out is the queue of the filter stage.
+         *
+         * \return None.
+         */
+        void AcquireStage(FrameSource &source, FrameQueue &in, FrameQueue &out);
+
+        /**
+         * \brief Filter stage: gets the star pixels of each frame.
+         *
+         * \param[in] in is the queue of the filter stage.
+         *
+         * \param[in] out is the queue of the centroider stage.
+         *
+         * \return None.
+         */
+        void FilterStage(FrameQueue &in, FrameQueue &out);
+
+        /**
+         * \brief Centroider stage: computes (and sorts) the centroids of each frame.
+         *
+         * \param[in] in is the queue of the centroider stage.
+         *
+         * \param[in] out is the queue of the output stage.
+         *
+         * \return None.
+         */
+        void CentroiderStage(FrameQueue &in, FrameQueue &out);
+
+    public:
+
+        /**
+         * \brief Class constructor.
+         *
+         * \param[in] star_filter is the star filter to use.
+         *
+         * \param[in] centroider is the centroider to use.
+         *
+         * \param[in] depth is the number of frames in flight (at least PIPELINE_MIN_DEPTH).
+         *
+         * \return None.
+         */
+        Pipeline(StarFilter *star_filter, Centroider *centroider, unsigned int depth=PIPELINE_DEFAULT_DEPTH);
+
+        /**
+         * \brief Sets the correction factor of the centroider.
+         *
+         * \param[in] a is the optimal constant to minimize the centroid position error.
+         *
+         * \return None.
+         */
+        void SetCorrectionFactor(float a);
+
+        /**
+         * \brief Enables or disables the sorting of the centroids by brightness (Centroider::SortCentroids).
+         *
+         * \param[in] en is true to sort the centroids (default), or false to keep the CDPU order.
+         *
+         * \return None.
+         */
+        void SetSortCentroids(bool en);
+
+        /**
+         * \brief Sets the number of frames in flight.
+         *
+         * \param[in] n is the new number of frames (at least PIPELINE_MIN_DEPTH).
+         *
+         * \return None.
+         */
+        void SetDepth(unsigned int n);
+
+        /**
+         * \brief Processes all the frames of a source.
+         *
+         * An error of any stage stops the pipeline and is thrown after all the threads are joined.
+         *
+         * \param[in] source is the frame source.
+         *
+         * \param[in] output is the function called (in the calling thread, in the sequence order) with each processed
+         * frame. The frame is only valid during the call.
+         *
+         * \return The number of processed frames.
+         */
+        unsigned long Run(FrameSource &source, const std::function<void(const PipelineFrame&)> &output);
+};
+
+#endif // PIPELINE_H_
+
+//! \} End of pipeline group
@@ -0,0 +1,184 @@
+/*
+ * spsc_queue.hpp
+ * 
+ * Copyright (C) 2020, Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ * 
+ * This file is part of CEST library.
+ * 
+ * CEST library is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * CEST library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with CEST library. If not, see <http://www.gnu.org/licenses/>.
+ * 
+ */
+
+/**
+ * \brief Lock-free single-producer/single-consumer queue.
+ * 
+ * \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ * 
+ * \version 0.1.0
+ * 
+ * \date 18/10/2026
+ * 
+ * \defgroup spsc-queue SPSC Queue
+ * \ingroup cest
+ * \{
+ */
+
+#ifndef SPSC_QUEUE_HPP_
+#define SPSC_QUEUE_HPP_
+
+#include <vector>
+#include <atomic>
+#include <cstddef>
+
+#define SPSC_QUEUE_CACHE_LINE_SIZE      64      /**< Cache line size in bytes (to keep the indexes in different lines). */
+
+/**
+ * \brief A bounded queue between exactly one producer thread and one consumer thread.
+ *
+ * The queue is a ring buffer indexed by two free-running counters: the head is only written by the producer and the tail
+ * only by the consumer, so no locks are needed. The counters are kept in different cache lines to avoid false sharing.
+ */
+template<class T>
+class SPSCQueue
+{
+    private:
+
+        /**
+         * \brief Ring buffer (its size is a power of two).
+         */
+        std::vector<T> buffer;
+
+        /**
+         * \brief Index mask (the buffer size minus one).
+         */
+        size_t mask;
+
+        /**
+         * \brief Padding between the read-only members and the head counter.
+         */
+        char pad0[SPSC_QUEUE_CACHE_LINE_SIZE];
+
+        /**
+         * \brief Number of pushed items (written by the producer).
+         */
+        std::atomic<size_t> head;
+
+        /**
+         * \brief Padding between the head and tail counters.
+         */
+        char pad1[SPSC_QUEUE_CACHE_LINE_SIZE - sizeof(std::atomic<size_t>)];
+
+        /**
+         * \brief Number of popped items (written by the consumer).
+         */
+        std::atomic<size_t> tail;
+
+        /**
+         * \brief Padding after the tail counter.
+         */
+        char pad2[SPSC_QUEUE_CACHE_LINE_SIZE - sizeof(std::atomic<size_t>)];
+
+    public:
+
+        /**
+         * \brief Class constructor.
+         *
+         * \param[in] capacity is the minimum number of items of the queue (it is rounded up to a power of two).
+         *
+         * \return None.
+         */
+        SPSCQueue(size_t capacity)
+            : head(0), tail(0)
+        {
+            size_t size = 1;
+
+            while(size < capacity)
+            {
+                size <<= 1;
+            }
+
+            this->buffer.resize(size);
+            this->mask = size - 1;
+        }
+
+        /**
+         * \brief Pushes an item (producer thread only).
+         *
+         * \param[in] item is the item to push.
+         *
+         * \return True if the item was pushed, or false if the queue is full.
+         */
+        bool Push(const T &item)
+        {
+            size_t h = this->head.load(std::memory_order_relaxed);
+
+            if (h - this->tail.load(std::memory_order_acquire) == this->buffer.size())
+            {
+                return false;
+            }
+
+            this->buffer[h & this->mask] = item;
+
+            this->head.store(h + 1, std::memory_order_release);
+
+            return true;
+        }
+
+        /**
+         * \brief Pops an item (consumer thread only).
+         *
+         * \param[out] item receives the popped item.
+         *
+         * \return True if an item was popped, or false if the queue is empty.
+         */
+        bool Pop(T &item)
+        {
+            size_t t = this->tail.load(std::memory_order_relaxed);
+
+            if (t == this->head.load(std::memory_order_acquire))
+            {
+                return false;
+            }
+
+            item = this->buffer[t & this->mask];
+
+            this->tail.store(t + 1, std::memory_order_release);
+
+            return true;
+        }
+
+        /**
+         * \brief Gets the capacity of the queue.
+         *
+         * \return The maximum number of items of the queue.
+         */
+        size_t GetCapacity() const
+        {
+            return this->buffer.size();
+        }
+
+        /**
+         * \brief Gets the number of items of the queue (only exact if the producer and the consumer are idle).
+         *
+         * \return The number of items of the queue.
+         */
+        size_t GetSize() const
+        {
+            return this->head.load(std::memory_order_acquire) - this->tail.load(std::memory_order_acquire);
+        }
+};
+
+#endif // SPSC_QUEUE_HPP_
+
+//! \} End of spsc-queue group
@@ -42,6 +42,8 @@
 #include <opencv2/opencv.hpp>
 
 #include "star_pixel.hpp"
+#include "star_pixel_buffer.hpp"
+#include "star_pixel_span.hpp"
 
 #define STAR_FILTER_DEFAULT_THRESHOLD_VAL   150         /**< Default value of the threshold filter (0 to 255). */
 
@@ -57,6 +59,22 @@ class StarFilter
          */
         uint8_t threshold;
 
+        /**
+         * \brief Values of the star pixels of the last spans (see the GetStarSpans method).
+         */
+        std::vector<uint8_t> span_values;
+
+        /**
+         * \brief Checks if the size of an image fits in a star pixel buffer.
+         *
+         * An exception is thrown if the image is too large.
+         *
+         * \param[in] img is the image to check.
+         *
+         * \return None.
+         */
+        void CheckBufferImageSize(const cv::Mat &img);
+
     public:
 
         /**
@@ -71,7 +89,7 @@ class StarFilter
          *
          * \return None.
          */
-        ~StarFilter();
+        virtual ~StarFilter();
 
         /**
          * \brief Sets the threshold value of the threshold filter.
@@ -96,7 +114,45 @@ class StarFilter
          *
          * \return A set of star pixels.
          */
-        virtual std::vector<cest::StarPixel> GetStarPixels(cv::Mat img);
+        virtual std::vector<cest::StarPixel> GetStarPixels(const cv::Mat &img);
+
+        /**
+         * \brief Gets star pixels from a given image into a caller-owned vector.
+         *
+         * The vector keeps its capacity between calls, so no memory is allocated once it is large enough.
+         *
+         * \param[in] img is the image to search for the star pixels.
+         *
+         * \param[out] star_pixels is the vector to store the star pixels (its previous content is removed).
+         *
+         * \return None.
+         */
+        virtual void GetStarPixels(const cv::Mat &img, std::vector<cest::StarPixel> &star_pixels);
+
+        /**
+         * \brief Gets star pixels from a given image into a star pixel buffer.
+         *
+         * \param[in] img is the image to search for the star pixels (up to 65536 x 65536 pixels).
+         *
+         * \param[out] star_pixels is the buffer to store the star pixels (its previous content is removed).
+         *
+         * \return None.
+         */
+        virtual void GetStarPixels(const cv::Mat &img, cest::StarPixelBuffer &star_pixels);
+
+        /**
+         * \brief Gets the runs of contiguous star pixels (spans) of a given image.
+         *
+         * The spans are built from the output of the GetStarPixels method (in the same order, and with the same values),
+         * and point to a copy of the pixel values kept by the filter, which is valid until the next call.
+         *
+         * \param[in] img is the image to search for the star pixels.
+         *
+         * \param[out] spans is the vector to store the star pixel spans (its previous content is removed).
+         *
+         * \return None.
+         */
+        virtual void GetStarSpans(const cv::Mat &img, std::vector<cest::StarPixelSpan> &spans);
 };
 
 #endif // STAR_FILTER_H_
@@ -37,18 +37,44 @@
 #ifndef STAR_FILTER_HW_H_
 #define STAR_FILTER_HW_H_
 
+#include <string>
+#include <cstdio>
+#include <vector>
+#include <memory>
+#include <functional>
+
 #include "star_filter.h"
+#include "thread_pool.h"
+#include "subprocess.h"
 
 #define STAR_FILTER_HW_VHDL_FILES_DIR           "/usr/local/share/cest"
 
-#define STAR_FILTER_HW_BUFFER_IMG               "/tmp/img_buf.pgm"
-#define STAR_FILTER_HW_BUFFER_STAR_PIXELS       "/tmp/star_pixels.csv"
+#define STAR_FILTER_HW_SCRATCH_DIR_TEMPLATE     "/tmp/cest_hw_XXXXXX"
+#define STAR_FILTER_HW_BUFFER_IMG               "img_buf.pgm"           /**< Image file (inside the scratch directory). */
+#define STAR_FILTER_HW_BUFFER_IMG_RAW           "img_buf.raw"           /**< Raw image file (inside the scratch directory). */
+#define STAR_FILTER_HW_BUFFER_STAR_PIXELS       "star_pixels.csv"       /**< Star pixels file (inside the scratch directory). */
+#define STAR_FILTER_HW_BUFFER_STAR_PIXELS_BIN   "star_pixels.bin"       /**< Binary star pixels file (inside the scratch directory). */
 #define STAR_FILTER_HW_SIM_MAX_TIME_US          "200000"
 
 #define STAR_FILTER_STAR_PIXELS_ROW_VAL         0
 #define STAR_FILTER_STAR_PIXELS_ROW_X           1
 #define STAR_FILTER_STAR_PIXELS_ROW_Y           2
 
+#define STAR_FILTER_HW_DEFAULT_SERVER_MODE      false
+#define STAR_FILTER_HW_DEFAULT_BINARY_LOG       false
+#define STAR_FILTER_HW_DEFAULT_RAW_INPUT        false                   /**< Default input mode (Netpbm file to a 800x600 sensor). */
+#define STAR_FILTER_HW_SERVER_TIMEOUT_MS        60000
+#define STAR_FILTER_HW_SERVER_STOP_TIMEOUT_MS   1000                    /**< Time for the server to quit before it is killed. */
+#define STAR_FILTER_HW_SERVER_POLL_MS           100                     /**< Poll period of the server FIFOs. */
+#define STAR_FILTER_HW_SERVER_READ_SIZE         4096                    /**< Read size of the star pixels FIFO. */
+#define STAR_FILTER_HW_SERVER_MAX_IMG_SIZE      4096
+#define STAR_FILTER_HW_SERVER_CMD_FRAME         'F'
+#define STAR_FILTER_HW_SERVER_CMD_QUIT          'Q'
+#define STAR_FILTER_HW_SERVER_CMD_FIFO          "cmd"                   /**< Frames FIFO (inside the scratch directory). */
+#define STAR_FILTER_HW_SERVER_RESP_FIFO         "resp"                  /**< Star pixels FIFO (inside the scratch directory). */
+
+#define STAR_FILTER_HW_DEFAULT_THREADS          1                       /**< Default number of parallel simulations of the batch mode. */
+
 /**
  * \brief A class to filter star pixels from a image.
  */
@@ -56,14 +82,68 @@ class StarFilterHW: public StarFilter
 {
     private:
 
+        /**
+         * \brief Server mode flag (the simulation is kept running between frames).
+         */
+        bool server_mode;
+
+        /**
+         * \brief Binary log flag (the star pixels are logged as binary records instead of CSV lines).
+         */
+        bool binary_log;
+
+        /**
+         * \brief Raw input flag (the image is given to the sensor as raw pixels instead of a Netpbm file).
+         */
+        bool raw_input;
+
+        /**
+         * \brief Simulation process of the server mode.
+         */
+        Subprocess server;
+
+        /**
+         * \brief File descriptor of the frames FIFO of the server mode.
+         */
+        int server_cmd_fd;
+
+        /**
+         * \brief Directory of the temporary files of the simulation.
+         */
+        std::string scratch_dir;
+
+        /**
+         * \brief True if the scratch directory was created by this object (it is removed in the destructor).
+         */
+        bool scratch_dir_owned;
+
+        /**
+         * \brief Thread pool of the batch mode.
+         */
+        ThreadPool pool;
+
+        /**
+         * \brief Simulation instances of the batch mode (one per thread).
+         */
+        std::vector<std::unique_ptr<StarFilterHW> > batch_sims;
+
+        /**
+         * \brief Removes the scratch directory (if it was created by this object).
+         *
+         * \return None.
+         */
+        void RemoveScratchDir();
+
         /**
          * \brief Runs a hardware simulation with a given image.
          *
+         * An exception is thrown if the simulation fails (the log file is not created).
+         *
          * \param[in] img is the image to run the hardware simulation.
          *
          * \return None.
          */
-        void RunSimulation(cv::Mat img);
+        void RunSimulation(const cv::Mat &img);
 
         /**
          * \brief Reads a list of star pixels from a CSV file.
@@ -72,10 +152,53 @@ class StarFilterHW: public StarFilter
          *
          * \return A list of star pixels.
          */
-        std::vector<cest::StarPixel> ReadStarPixelsFromFile(const char *file);
+        std::vector<cest::StarPixel> ReadStarPixelsFromFile(const std::string &file);
+
+        /**
+         * \brief Reads the star pixels of a CSV file one by one (overloaded).
+         *
+         * Only a row of the file is kept in memory, so the memory usage does not depend on the size of the file.
+         *
+         * \param[in] file is the CSV file to read the star pixels.
+         *
+         * \param[in] visitor is called with each star pixel of the file.
+         *
+         * \return None.
+         */
+        void ReadStarPixelsFromFile(const std::string &file, const std::function<void(const cest::StarPixel&)> &visitor);
+
+        /**
+         * \brief Starts the simulation server (if it is not running yet).
+         *
+         * \return None.
+         */
+        void StartServer();
+
+        /**
+         * \brief Stops the simulation server (if it is running).
+         *
+         * The server is killed if it does not quit in STAR_FILTER_HW_SERVER_STOP_TIMEOUT_MS milliseconds.
+         *
+         * \return None.
+         */
+        void StopServer();
+
+        /**
+         * \brief Sends a frame to the simulation server and reads its star pixels.
+         *
+         * An exception is thrown (and the server is stopped) if the server finishes, or if it does not read the frame or
+         * write its star pixels for STAR_FILTER_HW_SERVER_TIMEOUT_MS milliseconds.
+         *
+         * \param[in] img is the image to run the hardware simulation.
+         *
+         * \return A list of star pixels.
+         */
+        std::vector<cest::StarPixel> RunServerFrame(const cv::Mat &img);
 
     public:
 
+        using StarFilter::GetStarPixels;
+
         /**
          * \brief Class constructor.
          *
@@ -100,12 +223,55 @@ class StarFilterHW: public StarFilter
         ~StarFilterHW();
 
         /**
-         * \brief Clears the memory buffer.
+         * \brief Clears the temporary files of the simulation.
          *
          * \return None.
          */
         void Clear();
 
+        /**
+         * \brief Writes an image as a raw file (8-bit pixels, or 16-bit little-endian pixels).
+         *
+         * This is the sensor input file of the raw input mode (RAW_INPUT generic).
+         *
+         * Color images are written using the green channel.
+         *
+         * \param[in] img is the image to write.
+         *
+         * \param[in] file is the output file.
+         *
+         * \return None.
+         */
+        static void WriteRawImage(const cv::Mat &img, const std::string &file);
+
+        /**
+         * \brief Formats a variable of the make command line of the simulation.
+         *
+         * make expands the variable references of the values, so the '$' characters are escaped (the Makefile quotes the
+         * values for the shell).
+         *
+         * \param[in] name is the variable name.
+         *
+         * \param[in] value is the variable value (as a file name).
+         *
+         * \return The "name=value" argument.
+         */
+        static std::string MakeVariable(const std::string &name, const std::string &value);
+
+        /**
+         * \brief Scales a threshold value to the pixel size of an image.
+         *
+         * The threshold values are given for 8-bit pixels, so they are shifted to the full range of the 16-bit pixels
+         * (thr*256) and keep the same meaning for both pixel sizes.
+         *
+         * \param[in] thr is the threshold value (0 to 255).
+         *
+         * \param[in] img is the image to filter.
+         *
+         * \return The threshold value for the pixels of the image (THRESHOLD generic of the simulation).
+         */
+        static unsigned int ScaleThreshold(uint8_t thr, const cv::Mat &img);
+
         /**
          * \brief Gets star pixels from a given image.
          *
@@ -113,7 +279,21 @@ class StarFilterHW: public StarFilter
          *
          * \return A set of star pixels.
          */
-        std::vector<cest::StarPixel> GetStarPixels(cv::Mat img);
+        std::vector<cest::StarPixel> GetStarPixels(const cv::Mat &img);
+
+        /**
+         * \brief Gets star pixels from a given image one by one.
+         *
+         * Without the server mode, the star pixels are streamed from the simulation log and no list is built, so the memory
+         * usage does not depend on the size of the log. The server mode still reads the star pixels of the frame as a list.
+         *
+         * \param[in] img is the image to search for the star pixels.
+         *
+         * \param[in] visitor is called with each star pixel of the given image.
+         *
+         * \return None.
+         */
+        void VisitStarPixels(const cv::Mat &img, const std::function<void(const cest::StarPixel&)> &visitor);
 
         /**
          * \brief Gets star pixels from a given image with a custom threshold value.
@@ -122,16 +302,128 @@ class StarFilterHW: public StarFilter
          *
          * \return A vector with the star pixels of the given image .
          */
-        std::vector<cest::StarPixel> GetStarPixels(cv::Mat img, uint8_t thr);
+        std::vector<cest::StarPixel> GetStarPixels(const cv::Mat &img, uint8_t thr);
+
+        /**
+         * \brief Gets star pixels from a set of images (batch mode).
+         *
+         * The images are distributed across parallel simulations (one per thread of the batch mode), each one with its
+         * own scratch directory.
+         *
+         * \param[in] imgs is the list of images to search for the star pixels.
+         *
+         * \param[out] star_pixels is the vector to store the star pixels of each image (its previous content is removed).
+         *
+         * \return None.
+         */
+        void GetStarPixels(const std::vector<cv::Mat> &imgs, std::vector<std::vector<cest::StarPixel> > &star_pixels);
 
         /**
          * \brief Sets the threshold value of the threshold filter.
          *
+         * The value is given for 8-bit pixels, and it is scaled for 16-bit images (see ScaleThreshold()).
+         *
          * \param[in] val is the new threshold value.
          *
          * \return None.
          */
         void SetThreshold(uint8_t val);
+
+        /**
+         * \brief Enables or disables the server mode.
+         *
+         * In the server mode, the VHDL design is analyzed and elaborated only once, and the simulation keeps running
+         * between frames. The frames and the threshold values are sent to the simulation through a named pipe, and
+         * the star pixels of each frame are received through another one.
+         *
+         * \param[in] en is true to enable the server mode, false to disable it (the simulation server is stopped).
+         *
+         * \return None.
+         */
+        void SetServerMode(bool en);
+
+        /**
+         * \brief Gets the server mode flag.
+         *
+         * \return True if the server mode is enabled, false otherwise.
+         */
+        bool GetServerMode();
+
+        /**
+         * \brief Enables or disables the binary log.
+         *
+         * With the binary log, the simulation keeps the log file open and writes a fixed-width record per star pixel,
+         * and the file is mapped in memory to read the star pixels (see the StarPixelLog class). The server mode does
+         * not use log files.
+         *
+         * \param[in] en is true to enable the binary log, false to use the CSV log.
+         *
+         * \return None.
+         */
+        void SetBinaryLog(bool en);
+
+        /**
+         * \brief Gets the binary log flag.
+         *
+         * \return True if the binary log is enabled, false otherwise.
+         */
+        bool GetBinaryLog();
+
+        /**
+         * \brief Enables or disables the raw input.
+         *
+         * With the raw input, the pixels are written directly from the image buffer (without encoding), and the image
+         * size and the pixel size are given to the simulation as generics, so the sensor has no header to parse and
+         * can have any resolution. Without it (the default), the image is written as a binary Netpbm file to a 800x600
+         * sensor, and only 8-bit images are supported.
+         *
+         * \param[in] en is true to enable the raw input, false to use the Netpbm input.
+         *
+         * \return None.
+         */
+        void SetRawInput(bool en);
+
+        /**
+         * \brief Gets the raw input flag.
+         *
+         * \return True if the raw input is enabled, false otherwise.
+         */
+        bool GetRawInput();
+
+        /**
+         * \brief Sets the directory of the temporary files of the simulation.
+         *
+         * \param[in] dir is an existing directory (it is not removed), or an empty string to use a new temporary
+         * directory (created from STAR_FILTER_HW_SCRATCH_DIR_TEMPLATE and removed in the destructor).
+         *
+         * \return None.
+         */
+        void SetScratchDir(const std::string &dir);
+
+        /**
+         * \brief Gets the directory of the temporary files of the simulation.
+         *
+         * A new temporary directory is created if none was set.
+         *
+         * \return The path of the scratch directory.
+         */
+        std::string GetScratchDir();
+
+        /**
+         * \brief Sets the number of parallel simulations of the batch mode.
+         *
+         * \param[in] n is the new number of parallel simulations (0 = number of CPU cores).
+         *
+         * \return None.
+         */
+        void SetNumberOfThreads(unsigned int n);
+
+        /**
+         * \brief Gets the number of parallel simulations of the batch mode.
+         *
+         * \return The number of parallel simulations.
+         */
+        unsigned int GetNumberOfThreads();
 };
 
 #endif // STAR_FILTER_SW_H_
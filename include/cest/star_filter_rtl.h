@@ -0,0 +1,306 @@
+/*
+ * star_filter_rtl.h
+ * 
+ * Copyright (C) 2020, Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ * 
+ * This file is part of CEST library.
+ * 
+ * CEST library is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * CEST library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with CEST library. If not, see <http://www.gnu.org/licenses/>.
+ * 
+ */
+
+/**
+ * \brief Star filter (cycle-accurate model of the hardware) definition.
+ * 
+ * \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ * 
+ * \version 0.1.0
+ * 
+ * \date 18/10/2026
+ * 
+ * \defgroup star-filter-rtl Star Filter (RTL model)
+ * \ingroup cest
+ * \{
+ */
+
+#ifndef STAR_FILTER_RTL_H_
+#define STAR_FILTER_RTL_H_
+
+#include <vector>
+#include <stdint.h>
+
+#include "star_filter.h"
+
+#define STAR_FILTER_RTL_IMG_WIDTH               800         /**< Default image width of the Sensor block (IMAGE_WIDTH). */
+#define STAR_FILTER_RTL_IMG_HEIGHT              600         /**< Default image height of the Sensor block (IMAGE_HEIGHT). */
+#define STAR_FILTER_RTL_BLANK_REGION_CLKS       15          /**< Clock cycles between two rows (BLANK_REGION_CLKS). */
+#define STAR_FILTER_RTL_CLK_HALF_PERIOD_NS      10          /**< Half period of the Clock block in nanoseconds. */
+#define STAR_FILTER_RTL_SIM_MAX_TIME_US         200000      /**< Simulation stop time (the same of the StarFilterHW class). */
+#define STAR_FILTER_RTL_DEFAULT_RAW_INPUT       false       /**< Default input mode (the same of the StarFilterHW class). */
+
+/**
+ * \brief A cycle-accurate model of the VHDL star filter.
+ *
+ * The Sensor, Grayscale, Threshold, Counter and Log blocks of the StarFilter design (vhdl/cest) are modeled clock edge
+ * by clock edge, including the signal update order of the simulator. The star pixels are the same (and in the same
+ * order) of the log file written by the hardware simulation, including its quirks: the last image row is not sent by
+ * the sensor, and a star pixel at the end of a row is logged once per blank region cycle.
+ */
+class StarFilterRTL: public StarFilter
+{
+    private:
+
+        /**
+         * \brief Signals of the Sensor block.
+         */
+        struct SensorSignals
+        {
+            int pixclk;                     /**< Pixel clock (-1 = uninitialized). */
+            int hsync;                      /**< Horizontal sync (-1 = uninitialized). */
+            int vsync;                      /**< Vertical sync (-1 = uninitialized). */
+            uint8_t data;                   /**< Data output. */
+            bool header_ready;              /**< Netpbm header parsed flag. */
+            bool byte_dump;                 /**< Comment line flag. */
+            unsigned int header_line;       /**< Netpbm header line. */
+            unsigned int header_col;        /**< Netpbm header column. */
+            unsigned int column_counter;    /**< Image column counter. */
+            unsigned int line_counter;      /**< Image line counter. */
+        };
+
+        /**
+         * \brief Current values of the sensor signals.
+         */
+        SensorSignals sensor;
+
+        /**
+         * \brief Values assigned to the sensor signals (updated when the sensor process waits for a clock edge).
+         */
+        SensorSignals sensor_next;
+
+        /**
+         * \brief Image width of the sensor.
+         */
+        unsigned int width;
+
+        /**
+         * \brief Image height of the sensor.
+         */
+        unsigned int height;
+
+        /**
+         * \brief Raw input flag (the sensor reads raw pixels instead of a Netpbm file).
+         */
+        bool raw_input;
+
+        /**
+         * \brief Simulation stop time in nanoseconds.
+         */
+        uint64_t stop_time;
+
+        /**
+         * \brief Current simulation time in nanoseconds.
+         */
+        uint64_t time;
+
+        /**
+         * \brief Output of the Grayscale block.
+         */
+        uint8_t gray_pixel;
+
+        /**
+         * \brief Pixel clock of the Grayscale block (-1 = uninitialized).
+         */
+        int gray_clk;
+
+        /**
+         * \brief Output of the Threshold block.
+         */
+        uint8_t star_px_val;
+
+        /**
+         * \brief Pixel clock of the Threshold block.
+         */
+        int thresh_clk;
+
+        /**
+         * \brief Value of the x-axis counter.
+         */
+        unsigned int i_pos;
+
+        /**
+         * \brief Value of the y-axis counter.
+         */
+        unsigned int j_pos;
+
+        /**
+         * \brief Logged star pixels.
+         */
+        std::vector<cest::StarPixel> *log;
+
+        /**
+         * \brief Updates the sensor signals and runs the blocks sensitive to them, then goes to the next clock edge.
+         *
+         * \return True if the simulation can continue, false if the stop time was reached.
+         */
+        bool Wait();
+
+        /**
+         * \brief Runs the blocks sensitive to the pixel clock rising edge.
+         *
+         * \return None.
+         */
+        void PixelClockRisingEdge();
+
+        /**
+         * \brief Runs the blocks sensitive to the pixel clock falling edge.
+         *
+         * \return None.
+         */
+        void PixelClockFallingEdge();
+
+        /**
+         * \brief Runs the blocks sensitive to the horizontal sync falling edge.
+         *
+         * \return None.
+         */
+        void HSyncFallingEdge();
+
+        /**
+         * \brief Runs the header parser of the sensor with a byte of the input file.
+         *
+         * \param[in] byte is the input byte.
+         *
+         * \return None.
+         */
+        void ParseHeader(uint8_t byte);
+
+        /**
+         * \brief Gets the bit length of a counter output.
+         *
+         * \param[in] upper_limit is the upper counting limit of the counter.
+         *
+         * \return The number of bits of the counter output (enough for the values from 0 to upper_limit).
+         */
+        unsigned int CounterBits(unsigned int upper_limit);
+
+    public:
+
+        using StarFilter::GetStarPixels;
+
+        /**
+         * \brief Class constructor.
+         *
+         * \return None.
+         */
+        StarFilterRTL();
+
+        /**
+         * \brief Class constructor (overloaded).
+         *
+         * \param[in] thr is the pixel threshold value.
+         *
+         * \return None.
+         */
+        StarFilterRTL(uint8_t thr);
+
+        /**
+         * \brief Class destructor.
+         *
+         * \return None.
+         */
+        ~StarFilterRTL();
+
+        /**
+         * \brief Gets star pixels from a given image.
+         *
+         * The sensor input is built as in the StarFilterHW class: the raw pixels of the image (and the image size as the
+         * sensor size), or a binary Netpbm file if the raw input is disabled. Only 8-bit images are supported.
+         *
+         * \param[in] img is the image to search for the star pixels.
+         *
+         * \return A set of star pixels.
+         */
+        std::vector<cest::StarPixel> GetStarPixels(const cv::Mat &img);
+
+        /**
+         * \brief Gets star pixels from a given image with a custom threshold value.
+         *
+         * \param[in] img is the image to search for the star pixels.
+         *
+         * \param[in] thr is the threshold value.
+         *
+         * \return A vector with the star pixels of the given image.
+         */
+        std::vector<cest::StarPixel> GetStarPixels(const cv::Mat &img, uint8_t thr);
+
+        /**
+         * \brief Runs the model with the content of the sensor input file.
+         *
+         * \param[in] file is the content of the sensor input file (a Netpbm file, or 8-bit raw pixels).
+         *
+         * \param[in] len is the length of the file in bytes.
+         *
+         * \param[out] star_pixels is the vector to store the logged star pixels (its previous content is removed).
+         *
+         * \return None.
+         */
+        void Run(const uint8_t *file, size_t len, std::vector<cest::StarPixel> &star_pixels);
+
+        /**
+         * \brief Sets the image size of the sensor (and the limits of the position counters).
+         *
+         * \param[in] w is the image width.
+         *
+         * \param[in] h is the image height.
+         *
+         * \return None.
+         */
+        void SetImageSize(unsigned int w, unsigned int h);
+
+        /**
+         * \brief Enables or disables the raw input.
+         *
+         * \param[in] en is true to enable the raw input (RAW_INPUT generic of the Sensor block), false otherwise.
+         *
+         * \return None.
+         */
+        void SetRawInput(bool en);
+
+        /**
+         * \brief Gets the raw input flag.
+         *
+         * \return True if the raw input is enabled, false otherwise.
+         */
+        bool GetRawInput();
+
+        /**
+         * \brief Sets the simulation stop time.
+         *
+         * \param[in] us is the stop time in microseconds.
+         *
+         * \return None.
+         */
+        void SetStopTime(uint64_t us);
+
+        /**
+         * \brief Gets the number of clock cycles of the last run.
+         *
+         * \return The number of simulated clock cycles.
+         */
+        uint64_t GetNumberOfCycles();
+};
+
+#endif // STAR_FILTER_RTL_H_
+
+//! \} End of star-filter-rtl group
@@ -38,14 +38,90 @@
 #define STAR_FILTER_SW_H_
 
 #include "star_filter.h"
+#include "threshold_kernel.h"
+#include "thread_pool.h"
+
+#define STAR_FILTER_SW_DEFAULT_THREADS          1       /**< Default number of threads (1 = serial filtering). */
+#define STAR_FILTER_SW_BANDS_PER_THREAD         4       /**< Number of row bands per thread (for load balancing). */
 
 /**
  * \brief A class to filter star pixels from a image.
  */
 class StarFilterSW: public StarFilter
 {
+    private:
+
+        /**
+         * \brief Threshold kernel.
+         */
+        ThresholdKernel kernel;
+
+        /**
+         * \brief Buffer with the columns of the star pixels of a line.
+         */
+        std::vector<unsigned int> columns;
+
+        /**
+         * \brief Thread pool of the parallel mode.
+         */
+        ThreadPool pool;
+
+        /**
+         * \brief Star pixels buffer of each row band (parallel mode).
+         */
+        std::vector<std::vector<cest::StarPixel> > band_pixels;
+
+        /**
+         * \brief Columns buffer of each row band (parallel mode).
+         */
+        std::vector<std::vector<unsigned int> > band_columns;
+
+        /**
+         * \brief Star pixel buffer of each row band (parallel mode).
+         */
+        std::vector<cest::StarPixelBuffer> band_buffers;
+
+        /**
+         * \brief Star pixel spans of each row band (parallel mode).
+         */
+        std::vector<std::vector<cest::StarPixelSpan> > band_spans;
+
+        /**
+         * \brief Filters an image (serial or parallel mode, according to the number of threads).
+         *
+         * \param[in] img is the image to search for the star pixels.
+         *
+         * \param[out] star_pixels is the list to append the star pixels found (std::vector of star pixels or spans, or StarPixelBuffer).
+         *
+         * \param[in,out] bands is the list of buffers of each row band (parallel mode).
+         *
+         * \return None.
+         */
+        template<class TStarPixels>
+        void Filter(const cv::Mat &img, TStarPixels &star_pixels, std::vector<TStarPixels> &bands);
+
+        /**
+         * \brief Filters a range of rows of an image.
+         *
+         * \param[in] img is the image to search for the star pixels.
+         *
+         * \param[in] first is the first row to filter.
+         *
+         * \param[in] last is the row after the last one to filter.
+         *
+         * \param[in,out] cols is a buffer to store the columns of the star pixels of a line.
+         *
+         * \param[out] star_pixels is the list to append the star pixels found (std::vector of star pixels or spans, or StarPixelBuffer).
+         *
+         * \return None.
+         */
+        template<class TStarPixels>
+        void FilterRows(const cv::Mat &img, int first, int last, std::vector<unsigned int> &cols, TStarPixels &star_pixels);
+
     public:
 
+        using StarFilter::GetStarPixels;
+
         /**
          * \brief Class constructor.
          *
@@ -69,7 +145,7 @@ class StarFilterSW: public StarFilter
          *
          * \return A set of star pixels.
          */
-        std::vector<cest::StarPixel> GetStarPixels(cv::Mat img);
+        std::vector<cest::StarPixel> GetStarPixels(const cv::Mat &img);
 
         /**
          * \brief Gets star pixels from a given image with a custom threshold value.
@@ -78,7 +154,44 @@ class StarFilterSW: public StarFilter
          *
          * \return A set of star pixels.
          */
-        std::vector<cest::StarPixel> GetStarPixels(cv::Mat img, uint8_t thr);
+        std::vector<cest::StarPixel> GetStarPixels(const cv::Mat &img, uint8_t thr);
+
+        /**
+         * \brief Gets star pixels from a given image into a caller-owned vector.
+         *
+         * The vector keeps its capacity between calls, so no memory is allocated once it is large enough.
+         *
+         * \param[in] img is the image to search for the star pixels.
+         *
+         * \param[out] star_pixels is the vector to store the star pixels (its previous content is removed).
+         *
+         * \return None.
+         */
+        void GetStarPixels(const cv::Mat &img, std::vector<cest::StarPixel> &star_pixels);
+
+        /**
+         * \brief Gets star pixels from a given image into a star pixel buffer.
+         *
+         * \param[in] img is the image to search for the star pixels (up to 65536 x 65536 pixels).
+         *
+         * \param[out] star_pixels is the buffer to store the star pixels (its previous content is removed).
+         *
+         * \return None.
+         */
+        void GetStarPixels(const cv::Mat &img, cest::StarPixelBuffer &star_pixels);
+
+        /**
+         * \brief Gets the runs of contiguous star pixels (spans) of a given image.
+         *
+         * The spans point to the image memory, so the image must outlive them.
+         *
+         * \param[in] img is the image to search for the star pixels.
+         *
+         * \param[out] spans is the vector to store the star pixel spans in raster order (its previous content is removed).
+         *
+         * \return None.
+         */
+        void GetStarSpans(const cv::Mat &img, std::vector<cest::StarPixelSpan> &spans);
 
         /**
          * \brief Sets the threshold value of the threshold filter.
@@ -88,6 +201,25 @@ class StarFilterSW: public StarFilter
          * \return None.
          */
         void SetThreshold(uint8_t val);
+
+        /**
+         * \brief Sets the number of threads used to filter an image.
+         *
+         * With more than one thread, the image is split into row bands that are filtered in parallel. The star pixels
+         * are returned in the same (raster) order as in the serial mode.
+         *
+         * \param[in] n is the number of threads (1 = serial mode, 0 = number of CPU cores).
+         *
+         * \return None.
+         */
+        void SetNumberOfThreads(unsigned int n);
+
+        /**
+         * \brief Gets the number of threads used to filter an image.
+         *
+         * \return The current number of threads.
+         */
+        unsigned int GetNumberOfThreads();
 };
 
 #endif // STAR_FILTER_SW_H_
@@ -0,0 +1,192 @@
+/*
+ * star_pixel_buffer.hpp
+ * 
+ * Copyright (C) 2020, Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ * 
+ * This file is part of CEST library.
+ * 
+ * CEST library is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * CEST library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with CEST library. If not, see <http://www.gnu.org/licenses/>.
+ * 
+ */
+
+/**
+ * \brief Star pixel buffer class.
+ * 
+ * \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ * 
+ * \version 0.1.0
+ * 
+ * \date 18/10/2026
+ * 
+ * \defgroup star-pixel-buffer Star Pixel Buffer
+ * \ingroup cest
+ * \{
+ */
+
+#ifndef STAR_PIXEL_BUFFER_HPP_
+#define STAR_PIXEL_BUFFER_HPP_
+
+#include <vector>
+#include <cstddef>
+#include <stdint.h>
+
+#include "star_pixel.hpp"
+
+#define STAR_PIXEL_BUFFER_MAX_IMAGE_SIZE    65536       /**< Maximum image width/height supported by the buffer (16-bit coordinates). */
+
+/**
+ * \brief CEST namespace.
+ */
+namespace cest
+{
+    /**
+     * \brief A list of star pixels stored as a structure of arrays.
+     *
+     * Each star pixel takes 5 bytes (8-bit value and two 16-bit coordinates) instead of the 12 bytes of a StarPixel
+     * object. Clearing the buffer keeps its capacity, so it can be reused between frames.
+     */
+    class StarPixelBuffer
+    {
+        public:
+
+            /**
+             * \brief Class constructor.
+             *
+             * \return None.
+             */
+            StarPixelBuffer()
+            {
+
+            }
+
+            /**
+             * \brief Class destructor.
+             *
+             * \return None.
+             */
+            ~StarPixelBuffer()
+            {
+
+            }
+
+            /**
+             * \brief Reserves memory for a number of star pixels.
+             *
+             * \param[in] n is the number of star pixels.
+             *
+             * \return None.
+             */
+            void Reserve(size_t n)
+            {
+                this->value.reserve(n);
+                this->x.reserve(n);
+                this->y.reserve(n);
+            }
+
+            /**
+             * \brief Removes all the star pixels (the allocated memory is kept).
+             *
+             * \return None.
+             */
+            void Clear()
+            {
+                this->value.clear();
+                this->x.clear();
+                this->y.clear();
+            }
+
+            /**
+             * \brief Appends a star pixel to the end of the buffer.
+             *
+             * \param[in] val is the pixel value.
+             *
+             * \param[in] x_pos is the x-axis position.
+             *
+             * \param[in] y_pos is the y-axis position.
+             *
+             * \return None.
+             */
+            void Append(uint8_t val, uint16_t x_pos, uint16_t y_pos)
+            {
+                this->value.push_back(val);
+                this->x.push_back(x_pos);
+                this->y.push_back(y_pos);
+            }
+
+            /**
+             * \brief Appends the star pixels of another buffer to the end of the buffer.
+             *
+             * \param[in] buf is the buffer to append.
+             *
+             * \return None.
+             */
+            void Append(const StarPixelBuffer &buf)
+            {
+                this->value.insert(this->value.end(), buf.value.begin(), buf.value.end());
+                this->x.insert(this->x.end(), buf.x.begin(), buf.x.end());
+                this->y.insert(this->y.end(), buf.y.begin(), buf.y.end());
+            }
+
+            /**
+             * \brief Gets the number of star pixels of the buffer.
+             *
+             * \return The number of star pixels.
+             */
+            size_t Size() const
+            {
+                return this->value.size();
+            }
+
+            /**
+             * \brief Checks if the buffer is empty.
+             *
+             * \return TRUE/FALSE if the buffer is empty or not.
+             */
+            bool Empty() const
+            {
+                return this->value.empty();
+            }
+
+            /**
+             * \brief Gets a star pixel of the buffer.
+             *
+             * \param[in] i is the position of the star pixel.
+             *
+             * \return The star pixel at the given position.
+             */
+            StarPixel Get(size_t i) const
+            {
+                return StarPixel(this->value[i], this->x[i], this->y[i]);
+            }
+
+            /**
+             * \brief Pixel values.
+             */
+            std::vector<uint8_t> value;
+
+            /**
+             * \brief X-axis positions.
+             */
+            std::vector<uint16_t> x;
+
+            /**
+             * \brief Y-axis positions.
+             */
+            std::vector<uint16_t> y;
+    };
+}
+
+#endif // STAR_PIXEL_BUFFER_HPP_
+
+//! \} End of star-pixel-buffer group
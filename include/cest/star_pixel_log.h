@@ -0,0 +1,177 @@
+/*
+ * star_pixel_log.h
+ * 
+ * Copyright (C) 2020, Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ * 
+ * This file is part of CEST library.
+ * 
+ * CEST library is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * CEST library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with CEST library. If not, see <http://www.gnu.org/licenses/>.
+ * 
+ */
+
+/**
+ * \brief Binary star pixel log reader definition.
+ * 
+ * \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ * 
+ * \version 0.1.0
+ * 
+ * \date 18/10/2026
+ * 
+ * \defgroup star-pixel-log Star Pixel Log
+ * \ingroup cest
+ * \{
+ */
+
+#ifndef STAR_PIXEL_LOG_H_
+#define STAR_PIXEL_LOG_H_
+
+#include <string>
+#include <vector>
+#include <cstddef>
+#include <stdint.h>
+
+#include "star_pixel.hpp"
+
+#define STAR_PIXEL_LOG_RECORD_SIZE      6       /**< Record size in bytes (value, x and y as 16-bit little-endian values). */
+
+/**
+ * \brief Record of the binary log of the Log block (vhdl/cest/log.vhd).
+ */
+struct StarPixelRecord
+{
+    uint16_t value;     /**< Pixel value. */
+    uint16_t x;         /**< X-axis position. */
+    uint16_t y;         /**< Y-axis position. */
+};
+
+static_assert(sizeof(StarPixelRecord) == STAR_PIXEL_LOG_RECORD_SIZE, "StarPixelRecord must have no padding!");
+
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ != __ORDER_LITTLE_ENDIAN__)
+#error "The binary star pixel log can only be mapped in little-endian hosts!"
+#endif
+
+/**
+ * \brief A read-only view of a binary star pixel log.
+ *
+ * The file is mapped in memory and its records are accessed in place, without copies or parsing.
+ */
+class StarPixelLog
+{
+    private:
+
+        /**
+         * \brief Mapped file (NULL if no file is mapped).
+         */
+        void *map;
+
+        /**
+         * \brief Mapped file length in bytes.
+         */
+        size_t map_len;
+
+        /**
+         * \brief Number of records.
+         */
+        size_t records;
+
+    public:
+
+        /**
+         * \brief Class constructor.
+         *
+         * \return None.
+         */
+        StarPixelLog();
+
+        /**
+         * \brief Class constructor with a file.
+         *
+         * \param[in] file is the binary log file to map.
+         *
+         * \return None.
+         */
+        StarPixelLog(const std::string &file);
+
+        /**
+         * \brief Class destructor.
+         *
+         * \return None.
+         */
+        ~StarPixelLog();
+
+        /**
+         * \brief The object owns a memory mapping, so it cannot be copied.
+         */
+        StarPixelLog(const StarPixelLog&) = delete;
+
+        /**
+         * \brief The object owns a memory mapping, so it cannot be copied.
+         */
+        StarPixelLog& operator=(const StarPixelLog&) = delete;
+
+        /**
+         * \brief Maps a binary log file (the current file is unmapped).
+         *
+         * An empty file is a log without records, and a missing file is an error.
+         *
+         * \param[in] file is the binary log file to map.
+         *
+         * \return None.
+         */
+        void Open(const std::string &file);
+
+        /**
+         * \brief Unmaps the current file.
+         *
+         * \return None.
+         */
+        void Close();
+
+        /**
+         * \brief Gets the number of records.
+         *
+         * \return The number of records of the log.
+         */
+        size_t GetSize() const;
+
+        /**
+         * \brief Gets the records of the log.
+         *
+         * \return A pointer to the first record (valid until the file is unmapped).
+         */
+        const StarPixelRecord* GetRecords() const;
+
+        /**
+         * \brief Gets a record as a star pixel.
+         *
+         * \param[in] i is the record index.
+         *
+         * \return The star pixel of the record.
+         */
+        cest::StarPixel operator[](size_t i) const;
+
+        /**
+         * \brief Appends all the records to a list of star pixels.
+         *
+         * \param[in,out] star_pixels is the list of star pixels.
+         *
+         * \return None.
+         */
+        void GetStarPixels(std::vector<cest::StarPixel> &star_pixels) const;
+};
+
+#endif // STAR_PIXEL_LOG_H_
+
+//! \} End of star-pixel-log group
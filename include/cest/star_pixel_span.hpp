@@ -0,0 +1,155 @@
+/*
+ * star_pixel_span.hpp
+ * 
+ * Copyright (C) 2020, Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ * 
+ * This file is part of CEST library.
+ * 
+ * CEST library is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * CEST library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with CEST library. If not, see <http://www.gnu.org/licenses/>.
+ * 
+ */
+
+/**
+ * \brief Star pixel span class.
+ * 
+ * \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ * 
+ * \version 0.1.0
+ * 
+ * \date 18/10/2026
+ * 
+ * \defgroup star-pixel-span Star Pixel Span
+ * \ingroup cest
+ * \{
+ */
+
+#ifndef STAR_PIXEL_SPAN_HPP_
+#define STAR_PIXEL_SPAN_HPP_
+
+#include <stdint.h>
+
+/**
+ * \brief CEST namespace.
+ */
+namespace cest
+{
+    /**
+     * \brief A run of contiguous star pixels in the same row of an image.
+     *
+     * The pixel values are not copied: the span points to the image memory, so the image must outlive it.
+     */
+    class StarPixelSpan
+    {
+        public:
+
+            /**
+             * \brief Class constructor.
+             *
+             * \return None.
+             */
+            StarPixelSpan()
+            {
+                this->row       = 0;
+                this->x_start   = 0;
+                this->x_end     = 0;
+                this->values    = 0;
+                this->step      = 1;
+            }
+
+            /**
+             * \brief Class constructor with initialization.
+             *
+             * \param[in] y_pos is the row of the span.
+             *
+             * \param[in] x_first is the x-axis position of the first pixel.
+             *
+             * \param[in] x_last is the x-axis position of the last pixel.
+             *
+             * \param[in] vals is a pointer to the value of the first pixel.
+             *
+             * \param[in] val_step is the distance in bytes between the values of two consecutive pixels.
+             *
+             * \return None.
+             */
+            StarPixelSpan(unsigned int y_pos, unsigned int x_first, unsigned int x_last, const uint8_t *vals, unsigned int val_step=1)
+            {
+                this->row       = y_pos;
+                this->x_start   = x_first;
+                this->x_end     = x_last;
+                this->values    = vals;
+                this->step      = val_step;
+            }
+
+            /**
+             * \brief Class destructor.
+             *
+             * \return None.
+             */
+            ~StarPixelSpan()
+            {
+
+            }
+
+            /**
+             * \brief Gets the number of pixels of the span.
+             *
+             * \return The number of pixels.
+             */
+            unsigned int Length() const
+            {
+                return this->x_end - this->x_start + 1;
+            }
+
+            /**
+             * \brief Gets the value of a pixel of the span.
+             *
+             * \param[in] x is the x-axis position of the pixel (x_start to x_end).
+             *
+             * \return The pixel value.
+             */
+            uint8_t GetValue(unsigned int x) const
+            {
+                return this->values[(x - this->x_start)*this->step];
+            }
+
+            /**
+             * \brief Y-axis position (row).
+             */
+            unsigned int row;
+
+            /**
+             * \brief X-axis position of the first pixel.
+             */
+            unsigned int x_start;
+
+            /**
+             * \brief X-axis position of the last pixel (inclusive).
+             */
+            unsigned int x_end;
+
+            /**
+             * \brief Pointer to the value of the first pixel.
+             */
+            const uint8_t *values;
+
+            /**
+             * \brief Distance in bytes between the values of two consecutive pixels.
+             */
+            unsigned int step;
+    };
+}
+
+#endif // STAR_PIXEL_SPAN_HPP_
+
+//! \} End of star-pixel-span group
@@ -0,0 +1,213 @@
+/*
+ * stream_labeler.h
+ * 
+ * Copyright (C) 2020, Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ * 
+ * This file is part of CEST library.
+ * 
+ * CEST library is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * CEST library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with CEST library. If not, see <http://www.gnu.org/licenses/>.
+ * 
+ */
+
+/**
+ * \brief Streaming blob labeler definition.
+ * 
+ * \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ * 
+ * \version 0.1.0
+ * 
+ * \date 18/10/2026
+ * 
+ * \defgroup stream-labeler Stream Labeler
+ * \ingroup cest
+ * \{
+ */
+
+#ifndef STREAM_LABELER_H_
+#define STREAM_LABELER_H_
+
+#include <vector>
+#include <stdint.h>
+
+#include "threshold_kernel.h"
+#include "centroid.hpp"
+#include "blob_forest.hpp"
+
+#define STREAM_LABELER_DEFAULT_THRESHOLD        150
+
+/**
+ * \brief Finds the centroids of the stars of a frame received row by row.
+ *
+ * Each row is thresholded and its star pixels are labeled in 8-connected blobs. Only the labels of the previous and
+ * the current rows and the accumulators of the open blobs are kept, so the memory usage is O(width + open blobs). A
+ * centroid is given as soon as its blob has no star pixels in the last received row, before the end of the frame.
+ *
+ * The centroids are computed as in the CentroiderCCL class.
+ */
+class StreamLabeler
+{
+    private:
+
+        /**
+         * \brief Threshold-and-compact kernel.
+         */
+        ThresholdKernel kernel;
+
+        /**
+         * \brief Threshold value (a star pixel must be greater than it).
+         */
+        uint8_t threshold;
+
+        /**
+         * \brief Row width in pixels.
+         */
+        unsigned int width;
+
+        /**
+         * \brief Index of the next row of the frame.
+         */
+        unsigned int row;
+
+        /**
+         * \brief Blobs and their moments.
+         */
+        cest::BlobForest blobs;
+
+        /**
+         * \brief Last row with pixels of each blob slot.
+         */
+        std::vector<unsigned int> last_row;
+
+        /**
+         * \brief Blob slots in use.
+         */
+        std::vector<unsigned int> open_blobs;
+
+        /**
+         * \brief Blob slots available to be reused.
+         */
+        std::vector<unsigned int> free_blobs;
+
+        /**
+         * \brief Labels of the previous row (blob slot + 1, 0 = no star pixel).
+         */
+        std::vector<unsigned int> prev_labels;
+
+        /**
+         * \brief Labels of the current row (blob slot + 1, 0 = no star pixel).
+         */
+        std::vector<unsigned int> cur_labels;
+
+        /**
+         * \brief Positions of the star pixels of the previous row.
+         */
+        std::vector<unsigned int> prev_xs;
+
+        /**
+         * \brief Positions of the star pixels of the current row.
+         */
+        std::vector<unsigned int> cur_xs;
+
+        /**
+         * \brief Gets a free blob slot.
+         *
+         * \return The blob slot.
+         */
+        unsigned int NewBlob();
+
+    public:
+
+        /**
+         * \brief Class constructor.
+         *
+         * \param[in] w is the row width in pixels.
+         *
+         * \param[in] thr is the threshold value.
+         *
+         * \return None.
+         */
+        StreamLabeler(unsigned int w=0, uint8_t thr=STREAM_LABELER_DEFAULT_THRESHOLD);
+
+        /**
+         * \brief Class destructor.
+         *
+         * \return None.
+         */
+        ~StreamLabeler();
+
+        /**
+         * \brief Sets the threshold value.
+         *
+         * \param[in] thr is the new threshold value (a star pixel must be greater than it).
+         *
+         * \return None.
+         */
+        void SetThreshold(uint8_t thr);
+
+        /**
+         * \brief Sets the row width (the current frame is discarded).
+         *
+         * \param[in] w is the new row width in pixels.
+         *
+         * \return None.
+         */
+        void SetWidth(unsigned int w);
+
+        /**
+         * \brief Gets the row width.
+         *
+         * \return The row width in pixels.
+         */
+        unsigned int GetWidth();
+
+        /**
+         * \brief Gets the number of open blobs (blobs with pixels in the last received row).
+         *
+         * \return The number of open blobs.
+         */
+        unsigned int GetNumberOfOpenBlobs();
+
+        /**
+         * \brief Processes the next row of the frame.
+         *
+         * \param[in] pix is a pointer to the first pixel of the row (width pixels).
+         *
+         * \param[in,out] centroids is the list where the centroids of the finished blobs are appended.
+         *
+         * \param[in] step is the distance in bytes between two consecutive pixels (1 for a contiguous row).
+         *
+         * \return The number of centroids appended to the list.
+         */
+        unsigned int PushRow(const uint8_t *pix, std::vector<cest::Centroid> &centroids, unsigned int step=1);
+
+        /**
+         * \brief Ends the current frame (the next row is the first row of a new frame).
+         *
+         * \param[in,out] centroids is the list where the centroids of the remaining blobs are appended.
+         *
+         * \return The number of centroids appended to the list.
+         */
+        unsigned int EndFrame(std::vector<cest::Centroid> &centroids);
+
+        /**
+         * \brief Discards the current frame.
+         *
+         * \return None.
+         */
+        void Reset();
+};
+
+#endif // STREAM_LABELER_H_
+
+//! \} End of stream-labeler group
@@ -0,0 +1,162 @@
+/*
+ * subprocess.h
+ * 
+ * Copyright (C) 2020, Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ * 
+ * This file is part of CEST library.
+ * 
+ * CEST library is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * CEST library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with CEST library. If not, see <http://www.gnu.org/licenses/>.
+ * 
+ */
+
+/**
+ * \brief Child process definition.
+ * 
+ * \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ * 
+ * \version 0.1.0
+ * 
+ * \date 18/10/2026
+ * 
+ * \defgroup subprocess Subprocess
+ * \ingroup cest
+ * \{
+ */
+
+#ifndef SUBPROCESS_H_
+#define SUBPROCESS_H_
+
+#include <string>
+#include <vector>
+
+#include <sys/types.h>
+
+#define SUBPROCESS_EXIT_SIGNAL      -1      /**< Exit code of a process terminated by a signal. */
+#define SUBPROCESS_EXIT_ERROR       -2      /**< Exit code of a process whose status could not be read (waitpid() failed). */
+
+#define SUBPROCESS_DEFAULT_MAX_FD   1024    /**< Number of file descriptors closed in the child if the limit is unknown. */
+
+/**
+ * \brief A child process started without a shell (fork/execvp).
+ *
+ * The arguments are passed directly to the program, so they do not need to be quoted. The child runs in its own process
+ * group, so the Kill method also stops the processes started by it (as the GHDL simulation started by make). The child
+ * only keeps the standard file descriptors, so it cannot hold the FIFOs or files of other objects of the process.
+ */
+class Subprocess
+{
+    private:
+
+        /**
+         * \brief PID of the child process (-1 if there is no running process).
+         */
+        pid_t pid;
+
+        /**
+         * \brief Exit code of the last finished process.
+         */
+        int exit_code;
+
+        /**
+         * \brief Stores the exit code of a finished process.
+         *
+         * \param[in] status is the status returned by waitpid().
+         *
+         * \return None.
+         */
+        void SetExitStatus(int status);
+
+        /**
+         * \brief Marks the process as finished with an unknown status (waitpid() failed).
+         *
+         * \return None.
+         */
+        void SetWaitError();
+
+    public:
+
+        /**
+         * \brief Class constructor.
+         *
+         * \return None.
+         */
+        Subprocess();
+
+        /**
+         * \brief Class destructor (a running process is killed).
+         *
+         * \return None.
+         */
+        ~Subprocess();
+
+        /**
+         * \brief The object owns a process, so it cannot be copied.
+         */
+        Subprocess(const Subprocess&) = delete;
+
+        /**
+         * \brief The object owns a process, so it cannot be copied.
+         */
+        Subprocess& operator=(const Subprocess&) = delete;
+
+        /**
+         * \brief Starts a process (a running process is killed first).
+         *
+         * The standard output of the process is discarded.
+         *
+         * \param[in] args is the program (searched in the PATH) followed by its arguments.
+         *
+         * \param[in] quiet is true to also discard the standard error of the process.
+         *
+         * \return None.
+         */
+        void Start(const std::vector<std::string> &args, bool quiet=false);
+
+        /**
+         * \brief Waits for the process to finish.
+         *
+         * \return The exit code of the process (127 if the program could not be executed, SUBPROCESS_EXIT_SIGNAL if it
+         *         was terminated by a signal, or SUBPROCESS_EXIT_ERROR if its status could not be read).
+         */
+        int Wait();
+
+        /**
+         * \brief Checks if the process is running (a finished process is reaped).
+         *
+         * \return True if the process is running, or false otherwise.
+         */
+        bool IsRunning();
+
+        /**
+         * \brief Kills the process (and its process group) and waits for it.
+         *
+         * \return None.
+         */
+        void Kill();
+
+        /**
+         * \brief Runs a process and waits for it to finish.
+         *
+         * \param[in] args is the program (searched in the PATH) followed by its arguments.
+         *
+         * \param[in] quiet is true to also discard the standard error of the process.
+         *
+         * \return The exit code of the process (see the Wait method).
+         */
+        static int Run(const std::vector<std::string> &args, bool quiet=false);
+};
+
+#endif // SUBPROCESS_H_
+
+//! \} End of subprocess group
@@ -0,0 +1,185 @@
+/*
+ * thread_pool.h
+ * 
+ * Copyright (C) 2020, Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ * 
+ * This file is part of CEST library.
+ * 
+ * CEST library is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * CEST library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with CEST library. If not, see <http://www.gnu.org/licenses/>.
+ * 
+ */
+
+/**
+ * \brief Thread pool definition.
+ * 
+ * \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ * 
+ * \version 0.1.0
+ * 
+ * \date 18/10/2026
+ * 
+ * \defgroup thread-pool Thread Pool
+ * \ingroup cest
+ * \{
+ */
+
+#ifndef THREAD_POOL_H_
+#define THREAD_POOL_H_
+
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <exception>
+
+/**
+ * \brief A fixed-size pool of threads to run a set of independent tasks.
+ *
+ * The calling thread also runs tasks, so a pool with n threads has n-1 worker threads.
+ */
+class ThreadPool
+{
+    private:
+
+        /**
+         * \brief Worker threads.
+         */
+        std::vector<std::thread> workers;
+
+        /**
+         * \brief Mutex to protect the pool state.
+         */
+        std::mutex pool_mutex;
+
+        /**
+         * \brief Signalizes the workers that a new set of tasks is available.
+         */
+        std::condition_variable start;
+
+        /**
+         * \brief Signalizes the calling thread that all the tasks are done.
+         */
+        std::condition_variable done;
+
+        /**
+         * \brief Current task function (receives the task index).
+         */
+        const std::function<void(unsigned int)> *task;
+
+        /**
+         * \brief Number of tasks of the current run.
+         */
+        unsigned int tasks;
+
+        /**
+         * \brief Index of the next task to run.
+         */
+        unsigned int next_task;
+
+        /**
+         * \brief Number of finished tasks of the current run.
+         */
+        unsigned int finished_tasks;
+
+        /**
+         * \brief First exception thrown by a task of the current run.
+         */
+        std::exception_ptr error;
+
+        /**
+         * \brief Run counter (used to wake up the workers).
+         */
+        unsigned long generation;
+
+        /**
+         * \brief Flag to stop the worker threads.
+         */
+        bool stop;
+
+        /**
+         * \brief Worker thread loop.
+         *
+         * \return None.
+         */
+        void Worker();
+
+        /**
+         * \brief Runs the pending tasks of the current run.
+         *
+         * \param[in] lock is the lock of the pool mutex (must be locked).
+         *
+         * \return None.
+         */
+        void RunTasks(std::unique_lock<std::mutex> &lock);
+
+        /**
+         * \brief Stops and joins all the worker threads.
+         *
+         * \return None.
+         */
+        void Stop();
+
+    public:
+
+        /**
+         * \brief Class constructor.
+         *
+         * \param[in] n is the number of threads (including the calling thread).
+         *
+         * \return None.
+         */
+        ThreadPool(unsigned int n=1);
+
+        /**
+         * \brief Class destructor.
+         *
+         * \return None.
+         */
+        ~ThreadPool();
+
+        /**
+         * \brief Sets the number of threads of the pool.
+         *
+         * \param[in] n is the new number of threads (including the calling thread, 0 = number of CPU cores).
+         *
+         * \return None.
+         */
+        void SetNumberOfThreads(unsigned int n);
+
+        /**
+         * \brief Gets the number of threads of the pool.
+         *
+         * \return The number of threads (including the calling thread).
+         */
+        unsigned int GetNumberOfThreads();
+
+        /**
+         * \brief Runs a set of tasks and waits for all of them to finish.
+         *
+         * \param[in] n is the number of tasks.
+         *
+         * \param[in] task is the function to run, called once for each task index (0 to n-1).
+         *
+         * If a task throws an exception, the other tasks still run, and the first exception is rethrown when all of them
+         * are finished.
+         *
+         * \return None.
+         */
+        void Run(unsigned int n, const std::function<void(unsigned int)> &task);
+};
+
+#endif // THREAD_POOL_H_
+
+//! \} End of thread-pool group
@@ -0,0 +1,124 @@
+/*
+ * threshold_kernel.h
+ * 
+ * Copyright (C) 2020, Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ * 
+ * This file is part of CEST library.
+ * 
+ * CEST library is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * CEST library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with CEST library. If not, see <http://www.gnu.org/licenses/>.
+ * 
+ */
+
+/**
+ * \brief Threshold-and-compact kernel definition.
+ * 
+ * \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ * 
+ * \version 0.1.0
+ * 
+ * \date 18/10/2026
+ * 
+ * \defgroup threshold-kernel Threshold Kernel
+ * \ingroup cest
+ * \{
+ */
+
+#ifndef THRESHOLD_KERNEL_H_
+#define THRESHOLD_KERNEL_H_
+
+#include <stdint.h>
+
+#define THRESHOLD_KERNEL_SCALAR     0           /**< Portable scalar implementation. */
+#define THRESHOLD_KERNEL_SSE2       1           /**< SSE2 implementation (16 pixels per instruction). */
+#define THRESHOLD_KERNEL_AVX2       2           /**< AVX2 implementation (32 pixels per instruction). */
+
+/**
+ * \brief Finds the pixels of a line above a threshold value.
+ *
+ * The kernel compares a sequence of 8-bit pixels against a threshold and
+ * writes the index of every pixel above it (in ascending order) to an output
+ * buffer. The instruction set is chosen at runtime according to the CPU
+ * capabilities, and all the implementations give the same result.
+ */
+class ThresholdKernel
+{
+    private:
+
+        /**
+         * \brief Current kernel implementation.
+         */
+        unsigned int (*kernel)(const uint8_t *pix, unsigned int n, uint8_t thr, unsigned int *idx);
+
+        /**
+         * \brief Current instruction set.
+         */
+        int isa;
+
+    public:
+
+        /**
+         * \brief Class constructor.
+         *
+         * The best instruction set supported by the CPU is selected.
+         *
+         * \return None.
+         */
+        ThresholdKernel();
+
+        /**
+         * \brief Class destructor.
+         *
+         * \return None.
+         */
+        ~ThresholdKernel();
+
+        /**
+         * \brief Selects the instruction set of the kernel.
+         *
+         * If the given instruction set is not supported by the CPU, the best supported one below it is used.
+         *
+         * \param[in] isa is the instruction set (THRESHOLD_KERNEL_SCALAR, THRESHOLD_KERNEL_SSE2 or THRESHOLD_KERNEL_AVX2).
+         *
+         * \return None.
+         */
+        void SetInstructionSet(int isa);
+
+        /**
+         * \brief Gets the instruction set in use.
+         *
+         * \return The current instruction set.
+         */
+        int GetInstructionSet();
+
+        /**
+         * \brief Finds the pixels above a threshold value.
+         *
+         * \param[in] pix is a pointer to the first pixel.
+         *
+         * \param[in] n is the number of pixels to check.
+         *
+         * \param[in] step is the distance in bytes between two consecutive pixels (1 for a contiguous line).
+         *
+         * \param[in] thr is the threshold value (a pixel must be greater than it).
+         *
+         * \param[out] idx is the buffer to store the indexes of the pixels above the threshold (at least n positions).
+         *
+         * \return The number of pixels above the threshold.
+         */
+        unsigned int Run(const uint8_t *pix, unsigned int n, unsigned int step, uint8_t thr, unsigned int *idx);
+};
+
+#endif // THRESHOLD_KERNEL_H_
+
+//! \} End of threshold-kernel group
@@ -0,0 +1,304 @@
+/*
+ * batch_processor.cpp
+ * 
+ * Copyright (C) 2020, Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ * 
+ * This file is part of CEST library.
+ * 
+ * CEST library is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * CEST library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with CEST library. If not, see <http://www.gnu.org/licenses/>.
+ * 
+ */
+
+/**
+ * \brief Batch processor implementation.
+ * 
+ * \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ * 
+ * \version 0.1.0
+ * 
+ * \date 18/10/2026
+ * 
+ * \addtogroup batch-processor
+ * \{
+ */
+
+#include <algorithm>
+#include <utility>
+#include <stdexcept>
+
+#include <cest/batch_processor.h>
+
+using namespace std;
+using namespace cv;
+using namespace cest;
+
+BatchProcessor::BatchProcessor(unsigned int threads)
+{
+    this->threshold         = BATCH_PROCESSOR_DEFAULT_THRESHOLD;
+    this->max_cdpus         = BATCH_PROCESSOR_DEFAULT_MAX_CDPUS;
+    this->correction_factor = CENTROIDER_CDPU_DEFAULT_CORRECTION_FACTOR;
+    this->sort_centroids    = true;
+    this->abort             = false;
+
+    this->SetNumberOfThreads(threads);
+}
+
+void BatchProcessor::SetNumberOfThreads(unsigned int n)
+{
+    this->pool.SetNumberOfThreads(n);
+
+    this->CreateWorkers();
+}
+
+unsigned int BatchProcessor::GetNumberOfThreads()
+{
+    return this->pool.GetNumberOfThreads();
+}
+
+void BatchProcessor::SetThreshold(uint8_t val)
+{
+    this->threshold = val;
+
+    for(unsigned int i=0; i<this->workers.size(); i++)
+    {
+        this->workers[i]->star_filter.SetThreshold(val);
+    }
+}
+
+void BatchProcessor::SetNumberOfCDPUs(unsigned int n)
+{
+    this->max_cdpus = n;
+
+    for(unsigned int i=0; i<this->workers.size(); i++)
+    {
+        this->workers[i]->centroider.SetNumberOfCDPUs(n);
+    }
+}
+
+void BatchProcessor::SetCorrectionFactor(float a)
+{
+    this->correction_factor = a;
+}
+
+void BatchProcessor::SetSortCentroids(bool en)
+{
+    this->sort_centroids = en;
+}
+
+size_t BatchProcessor::Run(const vector<string> &files, const string &output_file)
+{
+    this->output.Open(output_file);
+
+    this->errors.clear();
+    this->fatal_error = nullptr;
+    this->abort = false;
+
+    // Contiguous ranges of the same size (the differences are balanced by the stealing)
+    unsigned int n = this->workers.size();
+
+    for(unsigned int i=0; i<n; i++)
+    {
+        this->workers[i]->begin = files.size()*i/n;
+        this->workers[i]->end   = files.size()*(i + 1)/n;
+    }
+
+    this->pool.Run(n, [&](unsigned int w) { this->Work(w, files); });
+
+    this->output.Close();
+
+    if (this->fatal_error)
+    {
+        rethrow_exception(this->fatal_error);
+    }
+
+    sort(this->errors.begin(), this->errors.end(), [](const BatchError &a, const BatchError &b) { return a.frame < b.frame; });
+
+    return files.size() - this->errors.size();
+}
+
+vector<BatchError> BatchProcessor::GetErrors()
+{
+    return this->errors;
+}
+
+void BatchProcessor::CreateWorkers()
+{
+    this->workers.clear();
+
+    for(unsigned int i=0; i<this->pool.GetNumberOfThreads(); i++)
+    {
+        unique_ptr<Worker> worker(new Worker);
+
+        worker->star_filter.SetThreshold(this->threshold);
+        worker->star_filter.SetNumberOfThreads(1);      // The parallelism is between frames
+        worker->centroider.SetNumberOfCDPUs(this->max_cdpus);
+        worker->begin   = 0;
+        worker->end     = 0;
+
+        this->workers.push_back(move(worker));
+    }
+}
+
+bool BatchProcessor::NextFrame(unsigned int w, size_t &frame)
+{
+    Worker &self = *this->workers[w];
+
+    while(true)
+    {
+        {
+            lock_guard<mutex> lock(self.range_mutex);
+
+            if (self.begin < self.end)
+            {
+                frame = self.begin++;
+
+                return true;
+            }
+        }
+
+        // Steals half of the largest remaining range
+        unsigned int victim = w;
+        size_t largest = 0;
+
+        for(unsigned int i=0; i<this->workers.size(); i++)
+        {
+            if (i == w)
+            {
+                continue;
+            }
+
+            lock_guard<mutex> lock(this->workers[i]->range_mutex);
+
+            size_t remaining = this->workers[i]->end - this->workers[i]->begin;
+
+            if (remaining > largest)
+            {
+                largest = remaining;
+                victim  = i;
+            }
+        }
+
+        if (largest == 0)
+        {
+            return false;
+        }
+
+        Worker &other = *this->workers[victim];
+
+        size_t begin, end;
+
+        {
+            lock_guard<mutex> lock(other.range_mutex);
+
+            // The range may have changed since it was checked
+            if (other.begin == other.end)
+            {
+                continue;
+            }
+
+            end     = other.end;
+            begin   = other.end - (other.end - other.begin + 1)/2;
+
+            other.end = begin;
+        }
+
+        lock_guard<mutex> lock(self.range_mutex);
+
+        self.begin  = begin;
+        self.end    = end;
+    }
+}
+
+void BatchProcessor::Work(unsigned int w, const vector<string> &files)
+{
+    Worker &worker = *this->workers[w];
+
+    size_t frame;
+
+    while(!this->abort and this->NextFrame(w, frame))
+    {
+        try
+        {
+            Mat img = this->LoadImage(worker, files[frame]);
+
+            worker.star_filter.GetStarPixels(img, worker.star_pixels);
+
+            worker.centroider.ComputeFromList(worker.star_pixels, worker.centroids, this->correction_factor);
+
+            if (this->sort_centroids)
+            {
+                worker.centroids = worker.centroider.SortCentroids(move(worker.centroids));
+            }
+        }
+        catch(exception &e)
+        {
+            lock_guard<mutex> lock(this->output_mutex);
+
+            this->errors.push_back(BatchError{frame, files[frame] + ": " + e.what()});
+
+            continue;
+        }
+
+        lock_guard<mutex> lock(this->output_mutex);
+
+        try
+        {
+            for(unsigned int i=0; i<worker.centroids.size(); i++)
+            {
+                this->output.WriteCell(frame);
+                this->output.WriteCell(worker.centroids[i].pixels);
+                this->output.WriteCell(worker.centroids[i].value);
+                this->output.WriteCell(worker.centroids[i].x);
+                this->output.WriteCell(worker.centroids[i].y);
+                this->output.EndRow();
+            }
+        }
+        catch(...)
+        {
+            // An output error stops the batch (the first error is kept, as the next ones are usually caused by it)
+            if (!this->fatal_error)
+            {
+                this->fatal_error = current_exception();
+            }
+
+            this->abort = true;
+        }
+    }
+
+    worker.mapped.Close();
+}
+
+Mat BatchProcessor::LoadImage(Worker &worker, const string &file)
+{
+    // Only 8-bit binary PGM images are mapped (the ASCII and 16-bit files are decoded by cv::imread())
+    if (MappedFrame::IsPNM(file) and (MappedFrame::GetPNMType(file) == CV_8UC1))
+    {
+        worker.mapped.Open(file);
+
+        return worker.mapped.GetImage();
+    }
+
+    worker.mapped.Close();
+
+    worker.img = imread(file, IMREAD_GRAYSCALE);
+
+    if (worker.img.empty())
+    {
+        throw runtime_error("Impossible to read the image file in " + string(__func__) + " method from " + __FILE__ + " file!");
+    }
+
+    return worker.img;
+}
+
+//! \} End of batch-processor group
@@ -33,6 +33,8 @@
  * \{
  */
 
+#include <algorithm>
+
 #include <cest/cdpu.h>
 
 using namespace cest;
@@ -56,18 +58,39 @@ void CDPU::Update(unsigned int x_new, unsigned int y_new, uint8_t color_new, flo
 {
     if (this->DistanceFrom(x_new, y_new) < DISTANCE_THRESHOLD_MAN)
     {
-        this->G *= a;
-        this->centroid.x = (this->G*this->centroid.x) + ((1-this->G)*x_new);
-        this->centroid.y = (this->G*this->centroid.y) + ((1-this->G)*y_new);
+        this->Accumulate(x_new, y_new, color_new, a);
+    }
+}
+
+void CDPU::UpdateSpan(const cest::StarPixelSpan &span, float a)
+{
+    long x_min, x_max;
 
-        this->centroid.value = (this->G*this->centroid.value) + ((1-this->G)*color_new);
-        this->centroid.pixels++;
+    if (this->GetRowRange(span.row, DISTANCE_THRESHOLD_MAN, x_min, x_max))
+    {
+        long first = std::max(x_min, (long)span.x_start);
+        long last = std::min(x_max, (long)span.x_end);
 
-        // Pixel counter
-        this->pixels++;
+        for(long x=first; x<=last; x++)
+        {
+            this->Accumulate(x, span.row, span.GetValue(x), a);
+        }
     }
 }
 
+void CDPU::Accumulate(unsigned int x_new, unsigned int y_new, uint8_t color_new, float a)
+{
+    this->G *= a;
+    this->centroid.x = (this->G*this->centroid.x) + ((1-this->G)*x_new);
+    this->centroid.y = (this->G*this->centroid.y) + ((1-this->G)*y_new);
+
+    this->centroid.value = (this->G*this->centroid.value) + ((1-this->G)*color_new);
+    this->centroid.pixels++;
+
+    // Pixel counter
+    this->pixels++;
+}
+
 void CDPU::SetCentroid(unsigned int x_new, unsigned int y_new, uint8_t color_new)
 {
     this->centroid.x = x_new;
@@ -86,6 +109,25 @@ float CDPU::DistanceFrom(unsigned int x_comp, unsigned int y_comp)
     return abs(this->centroid.x - x_comp) + abs(this->centroid.y - y_comp);
 }
 
+bool CDPU::GetRowRange(unsigned int y_comp, double d, long &x_min, long &x_max)
+{
+    // DistanceFrom() truncates each axis distance to an integer, so it is lower than d when the sum is up to ceil(d)-1
+    long max_dist = (long)std::ceil(d) - 1;
+
+    long x_dist = max_dist - std::abs((long)(this->centroid.y - y_comp));
+
+    if (x_dist < 0)
+    {
+        return false;
+    }
+
+    // |trunc(x - x_comp)| <= x_dist when x_comp is in the open interval (x - x_dist - 1, x + x_dist + 1)
+    x_min = (long)std::floor(this->centroid.x - x_dist - 1) + 1;
+    x_max = (long)std::ceil(this->centroid.x + x_dist + 1) - 1;
+
+    return x_min <= x_max;
+}
+
 uint8_t CDPU::GetPixels()
 {
     return this->pixels;
@@ -0,0 +1,331 @@
+/*
+ * cdpu_bank.cpp
+ * 
+ * Copyright (C) 2020, Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ * 
+ * This file is part of CEST library.
+ * 
+ * CEST library is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * CEST library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with CEST library. If not, see <http://www.gnu.org/licenses/>.
+ * 
+ */
+
+/**
+ * \brief CDPU bank implementation.
+ * 
+ * \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ * 
+ * \version 0.1.0
+ * 
+ * \date 18/10/2026
+ * 
+ * \addtogroup cdpu-bank
+ * \{
+ */
+
+#include <cstdlib>
+#include <algorithm>
+
+#include <cest/cdpu_bank.h>
+
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#define CDPU_BANK_X86
+#include <immintrin.h>
+#endif
+
+using namespace std;
+using namespace cest;
+
+#ifdef CDPU_BANK_X86
+/**
+ * \brief AVX2 update of the CDPUs 4 by 4.
+ *
+ * The distances are truncated to integers per axis (as in CDPU::DistanceFrom()), and the gain, position and value
+ * are computed with the same float/double types of CDPU::Update(), so the results are the same of the scalar code.
+ *
+ * \return The number of CDPUs processed (a multiple of 4).
+ */
+__attribute__((target("avx2")))
+static unsigned int UpdateAVX2(double *x, double *y, unsigned int *value, unsigned int *pixels, float *G, unsigned int n,
+                               unsigned int x_new, unsigned int y_new, uint8_t color_new, float a, int gate)
+{
+    const __m256d x_v = _mm256_set1_pd(x_new);
+    const __m256d y_v = _mm256_set1_pd(y_new);
+    const __m128 x_f = _mm_set1_ps(x_new);
+    const __m128 y_f = _mm_set1_ps(y_new);
+    const __m128 color_f = _mm_set1_ps(color_new);
+    const __m128 a_v = _mm_set1_ps(a);
+    const __m128 one = _mm_set1_ps(1);
+    const __m128i gate_v = _mm_set1_epi32(gate);
+
+    unsigned int k = 0;
+
+    for(; k+4<=n; k+=4)
+    {
+        __m256d cx = _mm256_loadu_pd(x + k);
+        __m256d cy = _mm256_loadu_pd(y + k);
+
+        __m128i dx = _mm_abs_epi32(_mm256_cvttpd_epi32(_mm256_sub_pd(cx, x_v)));
+        __m128i dy = _mm_abs_epi32(_mm256_cvttpd_epi32(_mm256_sub_pd(cy, y_v)));
+
+        __m128i mask = _mm_cmplt_epi32(_mm_add_epi32(dx, dy), gate_v);
+
+        if (_mm_movemask_epi8(mask) == 0)
+        {
+            continue;
+        }
+
+        __m128 g = _mm_loadu_ps(G + k);
+        __m128 g_new = _mm_mul_ps(g, a_v);
+        __m128 g_inv = _mm_sub_ps(one, g_new);
+        __m256d g_d = _mm256_cvtps_pd(g_new);
+
+        __m256d cx_new = _mm256_add_pd(_mm256_mul_pd(g_d, cx), _mm256_cvtps_pd(_mm_mul_ps(g_inv, x_f)));
+        __m256d cy_new = _mm256_add_pd(_mm256_mul_pd(g_d, cy), _mm256_cvtps_pd(_mm_mul_ps(g_inv, y_f)));
+
+        __m128i val = _mm_loadu_si128((const __m128i*)(value + k));
+        __m128i val_new = _mm_cvttps_epi32(_mm_add_ps(_mm_mul_ps(g_new, _mm_cvtepi32_ps(val)), _mm_mul_ps(g_inv, color_f)));
+
+        __m128i pix = _mm_loadu_si128((const __m128i*)(pixels + k));
+
+        __m256d mask_d = _mm256_castsi256_pd(_mm256_cvtepi32_epi64(mask));
+
+        _mm256_storeu_pd(x + k, _mm256_blendv_pd(cx, cx_new, mask_d));
+        _mm256_storeu_pd(y + k, _mm256_blendv_pd(cy, cy_new, mask_d));
+        _mm_storeu_ps(G + k, _mm_blendv_ps(g, g_new, _mm_castsi128_ps(mask)));
+        _mm_storeu_si128((__m128i*)(value + k), _mm_blendv_epi8(val, val_new, mask));
+        _mm_storeu_si128((__m128i*)(pixels + k), _mm_sub_epi32(pix, mask));     // mask is -1 in the updated CDPUs
+    }
+
+    return k;
+}
+
+/**
+ * \brief AVX2 check of the CDPUs closer than a distance from a point.
+ *
+ * \return TRUE/FALSE if a CDPU closer than the distance was found or not (only the first multiple of 4 CDPUs are checked).
+ */
+__attribute__((target("avx2")))
+static bool IsCapturedAVX2(const double *x, const double *y, unsigned int n, unsigned int x_comp, unsigned int y_comp, int d)
+{
+    const __m256d x_v = _mm256_set1_pd(x_comp);
+    const __m256d y_v = _mm256_set1_pd(y_comp);
+    const __m128i d_v = _mm_set1_epi32(d);
+
+    for(unsigned int k=0; k+4<=n; k+=4)
+    {
+        __m128i dx = _mm_abs_epi32(_mm256_cvttpd_epi32(_mm256_sub_pd(_mm256_loadu_pd(x + k), x_v)));
+        __m128i dy = _mm_abs_epi32(_mm256_cvttpd_epi32(_mm256_sub_pd(_mm256_loadu_pd(y + k), y_v)));
+
+        if (_mm_movemask_epi8(_mm_cmplt_epi32(_mm_add_epi32(dx, dy), d_v)) != 0)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+#endif // CDPU_BANK_X86
+
+CDPUBank::CDPUBank()
+{
+    // DistanceFrom() is an integer, so "d < DISTANCE_THRESHOLD_MAN" is the same as "d < ceil(DISTANCE_THRESHOLD_MAN)"
+    this->gate = (int)ceil(DISTANCE_THRESHOLD_MAN);
+
+    this->SetInstructionSet(CDPU_BANK_AVX2);
+}
+
+CDPUBank::~CDPUBank()
+{
+
+}
+
+void CDPUBank::SetInstructionSet(int isa)
+{
+    this->isa = CDPU_BANK_SCALAR;
+
+#ifdef CDPU_BANK_X86
+    __builtin_cpu_init();
+
+    if ((isa >= CDPU_BANK_AVX2) and __builtin_cpu_supports("avx2"))
+    {
+        this->isa = CDPU_BANK_AVX2;
+    }
+#endif // CDPU_BANK_X86
+}
+
+int CDPUBank::GetInstructionSet()
+{
+    return this->isa;
+}
+
+void CDPUBank::Reserve(unsigned int n)
+{
+    this->x.reserve(n);
+    this->y.reserve(n);
+    this->value.reserve(n);
+    this->pixels.reserve(n);
+    this->G.reserve(n);
+}
+
+void CDPUBank::Clear()
+{
+    this->x.clear();
+    this->y.clear();
+    this->value.clear();
+    this->pixels.clear();
+    this->G.clear();
+}
+
+unsigned int CDPUBank::Size()
+{
+    return this->x.size();
+}
+
+unsigned int CDPUBank::Add(unsigned int x_new, unsigned int y_new, uint8_t color_new)
+{
+    this->x.push_back(x_new);
+    this->y.push_back(y_new);
+    this->value.push_back(color_new);
+    this->pixels.push_back(1);
+    this->G.push_back(1);
+
+    return this->x.size() - 1;
+}
+
+void CDPUBank::Update(unsigned int x_new, unsigned int y_new, uint8_t color_new, float a)
+{
+    unsigned int n = this->x.size();
+    unsigned int k = 0;
+
+#ifdef CDPU_BANK_X86
+    if (this->isa == CDPU_BANK_AVX2)
+    {
+        k = UpdateAVX2(this->x.data(), this->y.data(), this->value.data(), this->pixels.data(), this->G.data(), n,
+                       x_new, y_new, color_new, a, this->gate);
+    }
+#endif // CDPU_BANK_X86
+
+    for(; k<n; k++)
+    {
+        this->UpdateCDPU(k, x_new, y_new, color_new, a);
+    }
+}
+
+void CDPUBank::UpdateCDPU(unsigned int k, unsigned int x_new, unsigned int y_new, uint8_t color_new, float a)
+{
+    if (this->DistanceFrom(k, x_new, y_new) < this->gate)
+    {
+        this->Accumulate(k, x_new, y_new, color_new, a);
+    }
+}
+
+void CDPUBank::UpdateSpan(const StarPixelSpan &span, float a)
+{
+    for(unsigned int k=0; k<this->x.size(); k++)
+    {
+        this->UpdateSpanCDPU(k, span, span.x_start, a);
+    }
+}
+
+void CDPUBank::UpdateSpanCDPU(unsigned int k, const StarPixelSpan &span, unsigned int x_first, float a)
+{
+    long x_min, x_max;
+
+    if (this->GetRowRange(k, span.row, DISTANCE_THRESHOLD_MAN, x_min, x_max))
+    {
+        long first = max(x_min, (long)max(x_first, span.x_start));
+        long last = min(x_max, (long)span.x_end);
+
+        for(long x_pos=first; x_pos<=last; x_pos++)
+        {
+            this->Accumulate(k, x_pos, span.row, span.GetValue(x_pos), a);
+        }
+    }
+}
+
+void CDPUBank::Accumulate(unsigned int k, unsigned int x_new, unsigned int y_new, uint8_t color_new, float a)
+{
+    // Same arithmetic (and types) of CDPU::Update()
+    this->G[k] *= a;
+    this->x[k] = (this->G[k]*this->x[k]) + ((1-this->G[k])*x_new);
+    this->y[k] = (this->G[k]*this->y[k]) + ((1-this->G[k])*y_new);
+
+    this->value[k] = (this->G[k]*this->value[k]) + ((1-this->G[k])*color_new);
+    this->pixels[k]++;
+}
+
+bool CDPUBank::IsCaptured(unsigned int x_comp, unsigned int y_comp, unsigned int d)
+{
+    unsigned int n = this->x.size();
+    unsigned int k = 0;
+
+#ifdef CDPU_BANK_X86
+    if (this->isa == CDPU_BANK_AVX2)
+    {
+        if (IsCapturedAVX2(this->x.data(), this->y.data(), n, x_comp, y_comp, d))
+        {
+            return true;
+        }
+
+        k = n - n % 4;
+    }
+#endif // CDPU_BANK_X86
+
+    for(; k<n; k++)
+    {
+        if (this->DistanceFrom(k, x_comp, y_comp) < d)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+float CDPUBank::DistanceFrom(unsigned int k, unsigned int x_comp, unsigned int y_comp)
+{
+    return abs((int)(this->x[k] - x_comp)) + abs((int)(this->y[k] - y_comp));
+}
+
+bool CDPUBank::GetRowRange(unsigned int k, unsigned int y_comp, double d, long &x_min, long &x_max)
+{
+    // Same ranges of CDPU::GetRowRange()
+    long max_dist = (long)ceil(d) - 1;
+
+    long x_dist = max_dist - labs((long)(this->y[k] - y_comp));
+
+    if (x_dist < 0)
+    {
+        return false;
+    }
+
+    x_min = (long)floor(this->x[k] - x_dist - 1) + 1;
+    x_max = (long)ceil(this->x[k] + x_dist + 1) - 1;
+
+    return x_min <= x_max;
+}
+
+Centroid CDPUBank::GetCentroid(unsigned int k)
+{
+    Centroid centroid;
+
+    centroid.x      = this->x[k];
+    centroid.y      = this->y[k];
+    centroid.value  = this->value[k];
+    centroid.pixels = this->pixels[k];
+
+    return centroid;
+}
+
+//! \} End of cdpu-bank group
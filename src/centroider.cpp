@@ -34,9 +34,10 @@
  */
 
 #include <algorithm>
+#include <cmath>
 
 #include <cest/centroider.h>
-#include <cest/csv.hpp>
+#include <cest/csv_writer.h>
 
 using namespace std;
 using namespace cest;
@@ -44,6 +45,11 @@ using namespace cv;
 
 Centroider::Centroider()
 {
+    this->spatial_index = CENTROIDER_DEFAULT_SPATIAL_INDEX;
+    this->grid_cell     = 1;
+    this->grid_cols     = 0;
+    this->grid_rows     = 0;
+
     this->SetNumberOfCDPUs(CENTROIDER_DEFAULT_MAX_CDPUS);
     this->SetDistanceThreshold(CENTROIDER_DEFAULT_DISTANCE_THRESHOLD);
 }
@@ -61,21 +67,97 @@ Centroider::~Centroider()
 void Centroider::SetNumberOfCDPUs(unsigned int n)
 {
     this->max_cdpus = n;
+
+    this->cdpus.Reserve(n);
+    this->capture_ranges.reserve(n);
 }
 
 void Centroider::SetDistanceThreshold(unsigned int d)
 {
     this->distance_threshold = d;
+
+    // A CDPU can only capture or be updated by pixels closer than the largest threshold (in each axis)
+    this->grid_cell = max(max(d, (unsigned int)ceil(DISTANCE_THRESHOLD_MAN)), 1U);
+
+    if (this->spatial_index)
+    {
+        this->GridRebuild(this->grid_cols, this->grid_rows);
+    }
+}
+
+void Centroider::SetSpatialIndex(bool en)
+{
+    this->spatial_index = en;
+
+    if (en)
+    {
+        this->GridRebuild(this->grid_cols, this->grid_rows);
+    }
+    else
+    {
+        this->GridRebuild(0, 0);
+    }
+}
+
+bool Centroider::GetSpatialIndex()
+{
+    return this->spatial_index;
+}
+
+void Centroider::Compute(const StarPixel &star_pix, float a)
+{
+    this->Compute(star_pix.x, star_pix.y, star_pix.value, a);
+}
+
+void Centroider::Compute(unsigned int x, unsigned int y, uint8_t value, float a)
+{
+    if (this->spatial_index)
+    {
+        this->ComputeIndexed(x, y, value, a);
+
+        return;
+    }
+
+    if (this->cdpus.Size() < this->max_cdpus)
+    {
+        if (!this->cdpus.IsCaptured(x, y, this->distance_threshold))
+        {
+            this->cdpus.Add(x, y, value);
+        }
+    }
+
+    this->cdpus.Update(x, y, value, a);
 }
 
-void Centroider::Compute(StarPixel star_pix, float a)
+void Centroider::ComputeIndexed(unsigned int x, unsigned int y, uint8_t value, float a)
 {
-    if (this->cdpus.size() < this->max_cdpus)
+    unsigned int cx = x/this->grid_cell;
+    unsigned int cy = y/this->grid_cell;
+
+    if ((cx+1 >= this->grid_cols) or (cy+1 >= this->grid_rows))
+    {
+        this->GridRebuild(max(this->grid_cols, cx+2), max(this->grid_rows, cy+2));
+    }
+
+    // CDPUs of the 3x3 cells around the pixel
+    this->candidates.clear();
+
+    for(unsigned int j=((cy > 0) ? cy-1 : 0); j<=cy+1; j++)
+    {
+        for(unsigned int i=((cx > 0) ? cx-1 : 0); i<=cx+1; i++)
+        {
+            const vector<unsigned int> &cell = this->grid[j*this->grid_cols + i];
+
+            this->candidates.insert(this->candidates.end(), cell.begin(), cell.end());
+        }
+    }
+
+    if (this->cdpus.Size() < this->max_cdpus)
     {
         bool pix_capt = false;
-        for(unsigned int k=0; k<this->cdpus.size(); k++)
+        for(unsigned int k=0; k<this->candidates.size(); k++)
         {
-            if (this->cdpus[k].DistanceFrom(star_pix.x, star_pix.y) < this->distance_threshold)
+            if (this->cdpus.DistanceFrom(this->candidates[k], x, y) < this->distance_threshold)
             {
                 pix_capt = true;
             }
@@ -83,18 +165,85 @@ void Centroider::Compute(StarPixel star_pix, float a)
 
         if (!pix_capt)
         {
-            this->cdpus.push_back(CDPU());
-            this->cdpus[this->cdpus.size()-1].SetCentroid(star_pix.x, star_pix.y, star_pix.value);
+            unsigned int k = this->cdpus.Add(x, y, value);
+
+            this->cdpu_cells.push_back(this->GridCellOf(k));
+            this->grid[this->cdpu_cells[k]].push_back(k);
+
+            this->candidates.push_back(k);
         }
     }
 
-    for(unsigned int k=0; k<this->cdpus.size(); k++)
+    for(unsigned int k=0; k<this->candidates.size(); k++)
+    {
+        this->cdpus.UpdateCDPU(this->candidates[k], x, y, value, a);
+
+        this->GridMove(this->candidates[k]);
+    }
+}
+
+unsigned int Centroider::GridCellOf(unsigned int k)
+{
+    Centroid c = this->cdpus.GetCentroid(k);
+
+    unsigned int cx = min((unsigned int)(c.x/this->grid_cell), this->grid_cols-1);
+    unsigned int cy = min((unsigned int)(c.y/this->grid_cell), this->grid_rows-1);
+
+    return cy*this->grid_cols + cx;
+}
+
+void Centroider::GridMove(unsigned int k)
+{
+    unsigned int cell = this->GridCellOf(k);
+
+    if (cell != this->cdpu_cells[k])
+    {
+        vector<unsigned int> &old_cell = this->grid[this->cdpu_cells[k]];
+
+        *find(old_cell.begin(), old_cell.end(), k) = old_cell.back();
+        old_cell.pop_back();
+
+        this->grid[cell].push_back(k);
+        this->cdpu_cells[k] = cell;
+    }
+}
+
+void Centroider::GridRebuild(unsigned int cols, unsigned int rows)
+{
+    for(unsigned int k=0; k<this->cdpu_cells.size(); k++)
+    {
+        this->grid[this->cdpu_cells[k]].clear();
+    }
+
+    this->cdpu_cells.clear();
+
+    this->grid_cols = cols;
+    this->grid_rows = rows;
+
+    this->grid.resize(cols*rows);
+
+    if ((cols == 0) or (rows == 0))
+    {
+        return;
+    }
+
+    for(unsigned int k=0; k<this->cdpus.Size(); k++)
     {
-        this->cdpus[k].Update(star_pix.x, star_pix.y, star_pix.value, a);
+        this->cdpu_cells.push_back(this->GridCellOf(k));
+        this->grid[this->cdpu_cells[k]].push_back(k);
     }
 }
 
-vector<Centroid> Centroider::ComputeFromList(vector<StarPixel> stars, float a)
+vector<Centroid> Centroider::ComputeFromList(const vector<StarPixel> &stars, float a)
+{
+    vector<Centroid> centroids;
+
+    this->ComputeFromList(stars, centroids, a);
+
+    return centroids;
+}
+
+void Centroider::ComputeFromList(const vector<StarPixel> &stars, vector<Centroid> &centroids, float a)
 {
     this->Reset();
 
@@ -103,21 +252,178 @@ vector<Centroid> Centroider::ComputeFromList(vector<StarPixel> stars, float a)
         this->Compute(stars[i], a);
     }
 
-    return this->GetCentroids();
+    this->GetCentroids(centroids);
 }
 
-vector<Centroid> Centroider::GetCentroids()
+vector<Centroid> Centroider::ComputeFromList(const StarPixelBuffer &stars, float a)
 {
     vector<Centroid> centroids;
 
-    for(unsigned int i=0; i<cdpus.size(); i++)
+    this->ComputeFromList(stars, centroids, a);
+
+    return centroids;
+}
+
+void Centroider::ComputeFromList(const StarPixelBuffer &stars, vector<Centroid> &centroids, float a)
+{
+    this->Reset();
+
+    for(unsigned int i=0; i<stars.Size(); i++)
     {
-        centroids.push_back(cdpus[i].GetCentroid());
+        this->Compute(stars.x[i], stars.y[i], stars.value[i], a);
     }
 
+    this->GetCentroids(centroids);
+}
+
+void Centroider::Compute(const StarPixelSpan &span, float a)
+{
+    unsigned int n_old = this->cdpus.Size();
+
+    this->span_new_x.clear();
+
+    if (this->cdpus.Size() < this->max_cdpus)
+    {
+        // Capture ranges of the current CDPUs in the row of the span
+        this->capture_ranges.clear();
+
+        for(unsigned int k=0; k<this->cdpus.Size(); k++)
+        {
+            long x_min, x_max;
+
+            if (this->cdpus.GetRowRange(k, span.row, this->distance_threshold, x_min, x_max))
+            {
+                this->capture_ranges.push_back(make_pair(x_min, x_max));
+            }
+        }
+
+        // Creates a new CDPU for each part of the span not captured by the existing ones
+        long x = span.x_start;
+
+        while((x <= (long)span.x_end) and (this->cdpus.Size() < this->max_cdpus))
+        {
+            bool pix_capt = true;
+
+            while(pix_capt and (x <= (long)span.x_end))
+            {
+                pix_capt = false;
+
+                for(unsigned int k=0; k<this->capture_ranges.size(); k++)
+                {
+                    if ((x >= this->capture_ranges[k].first) and (x <= this->capture_ranges[k].second))
+                    {
+                        x = this->capture_ranges[k].second + 1;
+                        pix_capt = true;
+                    }
+                }
+            }
+
+            if (x > (long)span.x_end)
+            {
+                break;
+            }
+
+            unsigned int k = this->cdpus.Add(x, span.row, span.GetValue(x));
+
+            this->span_new_x.push_back(x);
+
+            long x_min, x_max;
+
+            if (this->cdpus.GetRowRange(k, span.row, this->distance_threshold, x_min, x_max))
+            {
+                this->capture_ranges.push_back(make_pair(x_min, x_max));
+            }
+
+            x++;
+        }
+    }
+
+    // The new CDPUs only receive the pixels from their creation positions (as in the pixel by pixel computation)
+    for(unsigned int k=0; k<this->cdpus.Size(); k++)
+    {
+        this->cdpus.UpdateSpanCDPU(k, span, (k < n_old) ? span.x_start : this->span_new_x[k - n_old], a);
+    }
+
+    if (this->spatial_index)
+    {
+        this->GridRebuild(this->grid_cols, this->grid_rows);
+    }
+}
+
+vector<Centroid> Centroider::ComputeFromSpans(const vector<StarPixelSpan> &spans, float a)
+{
+    vector<Centroid> centroids;
+
+    this->ComputeFromSpans(spans, centroids, a);
+
     return centroids;
 }
 
+void Centroider::ComputeFromSpans(const vector<StarPixelSpan> &spans, vector<Centroid> &centroids, float a)
+{
+    this->Reset();
+
+    for(unsigned int i=0; i<spans.size(); i++)
+    {
+        this->Compute(spans[i], a);
+    }
+
+    this->GetCentroids(centroids);
+}
+
+vector<Centroid> Centroider::ComputeFromImage(const Mat &img, uint8_t threshold, float a)
+{
+    vector<Centroid> centroids;
+
+    this->ComputeFromImage(img, threshold, centroids, a);
+
+    return centroids;
+}
+
+void Centroider::ComputeFromImage(const Mat &img, uint8_t threshold, vector<Centroid> &centroids, float a)
+{
+    this->Reset();
+
+    this->columns.resize(img.cols);
+
+    // Same pixels and order of StarFilterSW (color images are filtered using the green channel)
+    unsigned int step = (img.channels() > 1) ? 3 : 1;
+    unsigned int offset = (img.channels() > 1) ? 1 : 0;
+
+    for(int i=0; i<img.rows; i++)
+    {
+        const uint8_t *line = img.ptr<uchar>(i) + offset;
+
+        unsigned int n = this->kernel.Run(line, img.cols, step, threshold, this->columns.data());
+
+        for(unsigned int k=0; k<n; k++)
+        {
+            this->Compute(this->columns[k], i, line[this->columns[k]*step], a);
+        }
+    }
+
+    this->GetCentroids(centroids);
+}
+
+vector<Centroid> Centroider::GetCentroids()
+{
+    vector<Centroid> centroids;
+
+    this->GetCentroids(centroids);
+
+    return centroids;
+}
+
+void Centroider::GetCentroids(vector<Centroid> &centroids)
+{
+    centroids.clear();
+
+    for(unsigned int i=0; i<this->cdpus.Size(); i++)
+    {
+        centroids.push_back(this->cdpus.GetCentroid(i));
+    }
+}
+
 vector<Centroid> Centroider::SortCentroids(vector<Centroid> centroids)
 {
     sort(centroids.begin(), centroids.end(), [this](Centroid a, Centroid b) {return ((a.value*a.pixels) > (b.value*b.pixels)); });
@@ -127,7 +433,15 @@ vector<Centroid> Centroider::SortCentroids(vector<Centroid> centroids)
 
 void Centroider::Reset()
 {
-    this->cdpus.clear();
+    this->cdpus.Clear();
+
+    // Clears only the used grid cells
+    for(unsigned int k=0; k<this->cdpu_cells.size(); k++)
+    {
+        this->grid[this->cdpu_cells[k]].clear();
+    }
+
+    this->cdpu_cells.clear();
 }
 
 Mat Centroider::PrintCentroids(Mat img, vector<Centroid> centroids, bool print_id)
@@ -161,21 +475,27 @@ Mat Centroider::PrintCentroids(Mat img, vector<Centroid> centroids, bool print_i
 
 void Centroider::SaveCentroids(const char *file_name)
 {
-    CSV<double> centroids;
+    vector<Centroid> cents;
 
-    for(unsigned int i=0; i<cdpus.size(); i++)
-    {
-        vector<double> centroid;
+    this->GetCentroids(cents);
 
-        centroid.push_back(cdpus[i].GetCentroid().pixels);
-        centroid.push_back(cdpus[i].GetCentroid().value);
-        centroid.push_back(cdpus[i].GetCentroid().x);
-        centroid.push_back(cdpus[i].GetCentroid().y);
+    Centroider::SaveCentroids(cents, file_name);
+}
+
+void Centroider::SaveCentroids(const vector<Centroid> &centroids, const string &file_name)
+{
+    CSVWriter output(file_name);
 
-        centroids.AppendRow(centroid);
+    for(unsigned int i=0; i<centroids.size(); i++)
+    {
+        output.WriteCell(centroids[i].pixels);
+        output.WriteCell(centroids[i].value);
+        output.WriteCell(centroids[i].x);
+        output.WriteCell(centroids[i].y);
+        output.EndRow();
     }
 
-    centroids.Write(file_name);
+    output.Close();
 }
 
 //! \} End of centroider group
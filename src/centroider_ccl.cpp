@@ -0,0 +1,161 @@
+/*
+ * centroider_ccl.cpp
+ * 
+ * Copyright (C) 2020, Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ * 
+ * This file is part of CEST library.
+ * 
+ * CEST library is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * CEST library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with CEST library. If not, see <http://www.gnu.org/licenses/>.
+ * 
+ */
+
+/**
+ * \brief Connected-component labeling centroider implementation.
+ * 
+ * \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ * 
+ * \version 0.1.0
+ * 
+ * \date 18/10/2026
+ * 
+ * \addtogroup centroider-ccl
+ * \{
+ */
+
+#include <string>
+#include <stdexcept>
+
+#include <cest/centroider_ccl.h>
+
+using namespace std;
+using namespace cest;
+
+CentroiderCCL::CentroiderCCL()
+    : Centroider()
+{
+    this->row       = 0;
+    this->started   = false;
+}
+
+CentroiderCCL::~CentroiderCCL()
+{
+
+}
+
+void CentroiderCCL::Compute(unsigned int x, unsigned int y, uint8_t value, float a)
+{
+    if (!this->started or (y != this->row))
+    {
+        if (this->started and (y < this->row))
+        {
+            throw runtime_error("Star pixels out of row order in " + string(__func__) + " method from " + __FILE__ + " file!");
+        }
+
+        this->NextRow(y);
+    }
+
+    if (x+2 > this->cur_labels.size())
+    {
+        this->cur_labels.resize(x+2, 0);
+        this->prev_labels.resize(x+2, 0);
+    }
+
+    // Repeated star pixel
+    if (this->cur_labels[x] > 0)
+    {
+        return;
+    }
+
+    unsigned int label = this->blobs.JoinNeighbours(x, this->cur_labels, this->prev_labels);
+
+    unsigned int root = (label == 0) ? this->blobs.NewBlob() : label-1;
+
+    this->blobs.Add(root, x, y, value);
+
+    this->cur_labels[x] = root + 1;
+    this->cur_xs.push_back(x);
+}
+
+void CentroiderCCL::Compute(const StarPixelSpan &span, float a)
+{
+    for(unsigned int x=span.x_start; x<=span.x_end; x++)
+    {
+        this->Compute(x, span.row, span.GetValue(x), a);
+    }
+}
+
+void CentroiderCCL::GetCentroids(vector<Centroid> &centroids)
+{
+    centroids.clear();
+
+    for(unsigned int l=0; l<this->blobs.Size(); l++)
+    {
+        if (this->blobs.IsRoot(l) and (this->blobs.GetIntensity(l) > 0))
+        {
+            centroids.push_back(this->blobs.GetCentroid(l));
+        }
+    }
+}
+
+void CentroiderCCL::Reset()
+{
+    this->blobs.Clear();
+
+    // Clears only the used positions of the rows
+    for(unsigned int i=0; i<this->prev_xs.size(); i++)
+    {
+        this->prev_labels[this->prev_xs[i]] = 0;
+    }
+
+    for(unsigned int i=0; i<this->cur_xs.size(); i++)
+    {
+        this->cur_labels[this->cur_xs[i]] = 0;
+    }
+
+    this->prev_xs.clear();
+    this->cur_xs.clear();
+
+    this->started = false;
+}
+
+void CentroiderCCL::NextRow(unsigned int y)
+{
+    for(unsigned int i=0; i<this->prev_xs.size(); i++)
+    {
+        this->prev_labels[this->prev_xs[i]] = 0;
+    }
+
+    this->prev_xs.clear();
+
+    if (this->started and (y == this->row+1))
+    {
+        this->prev_labels.swap(this->cur_labels);
+        this->prev_xs.swap(this->cur_xs);
+    }
+    else
+    {
+        // The previous row has no star pixels
+        for(unsigned int i=0; i<this->cur_xs.size(); i++)
+        {
+            this->cur_labels[this->cur_xs[i]] = 0;
+        }
+
+        this->cur_xs.clear();
+    }
+
+    this->row       = y;
+    this->started   = true;
+}
+
+//! \} End of centroider-ccl group
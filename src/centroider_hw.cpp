@@ -0,0 +1,228 @@
+/*
+ * centroider_hw.cpp
+ * 
+ * Copyright (C) 2020, Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ * 
+ * This file is part of CEST library.
+ * 
+ * CEST library is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * CEST library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with CEST library. If not, see <http://www.gnu.org/licenses/>.
+ * 
+ */
+
+/**
+ * \brief Centroider (hardware simulation) implementation.
+ * 
+ * \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ * 
+ * \version 0.1.0
+ * 
+ * \date 18/10/2026
+ * 
+ * \addtogroup centroider-hw
+ * \{
+ */
+
+#include <cstdio>
+#include <cstdlib>
+#include <cmath>
+#include <stdexcept>
+
+#include <unistd.h>
+
+#include <cest/centroider_hw.h>
+#include <cest/star_filter_hw.h>
+#include <cest/csv_cursor.hpp>
+#include <cest/subprocess.h>
+
+using namespace std;
+using namespace cv;
+using namespace cest;
+
+CentroiderHW::CentroiderHW()
+{
+    this->threshold         = CENTROIDER_HW_DEFAULT_THRESHOLD;
+    this->scratch_dir_owned = false;
+
+    this->SetNumberOfCDPUs(CENTROIDER_DEFAULT_MAX_CDPUS);
+    this->SetDistanceThreshold(CENTROIDER_DEFAULT_DISTANCE_THRESHOLD);
+    this->SetCorrectionFactor(CENTROIDER_CDPU_DEFAULT_CORRECTION_FACTOR);
+}
+
+CentroiderHW::CentroiderHW(uint8_t thr)
+    : CentroiderHW()
+{
+    this->SetThreshold(thr);
+}
+
+CentroiderHW::~CentroiderHW()
+{
+    this->RemoveScratchDir();
+}
+
+void CentroiderHW::Clear()
+{
+    if (!this->scratch_dir.empty())
+    {
+        unlink((this->scratch_dir + "/" CENTROIDER_HW_BUFFER_IMG_RAW).c_str());
+        unlink((this->scratch_dir + "/" CENTROIDER_HW_BUFFER_CENTROIDS).c_str());
+    }
+}
+
+vector<Centroid> CentroiderHW::GetCentroids(const Mat &img)
+{
+    if (img.depth() != CV_8U)
+    {
+        throw invalid_argument("Only 8-bit images are supported in " + string(__func__) + " method from " + __FILE__ + " file!");
+    }
+
+    this->Clear();
+
+    this->RunSimulation(img);
+
+    return this->ReadCentroidsFromFile(this->GetScratchDir() + "/" CENTROIDER_HW_BUFFER_CENTROIDS);
+}
+
+void CentroiderHW::SetThreshold(uint8_t val)
+{
+    this->threshold = val;
+}
+
+uint8_t CentroiderHW::GetThreshold()
+{
+    return this->threshold;
+}
+
+void CentroiderHW::SetNumberOfCDPUs(unsigned int n)
+{
+    this->max_cdpus = n;
+}
+
+void CentroiderHW::SetDistanceThreshold(unsigned int d)
+{
+    this->distance_threshold = d;
+}
+
+void CentroiderHW::SetCorrectionFactor(float a)
+{
+    CDPUFixed<> cdpu;
+
+    cdpu.SetCorrectionFactor(a);
+
+    this->correction_factor = cdpu.GetCorrectionFactor();
+}
+
+void CentroiderHW::SetScratchDir(const string &dir)
+{
+    this->RemoveScratchDir();
+
+    this->scratch_dir = dir;
+}
+
+string CentroiderHW::GetScratchDir()
+{
+    if (this->scratch_dir.empty())
+    {
+        char dir_template[] = CENTROIDER_HW_SCRATCH_DIR_TEMPLATE;
+
+        if (!mkdtemp(dir_template))
+        {
+            throw runtime_error("mkdtemp() failed in " + string(__func__) + " method from " + __FILE__ + " file!");
+        }
+
+        this->scratch_dir       = dir_template;
+        this->scratch_dir_owned = true;
+    }
+
+    return this->scratch_dir;
+}
+
+void CentroiderHW::RemoveScratchDir()
+{
+    this->Clear();
+
+    if (this->scratch_dir_owned)
+    {
+        rmdir(this->scratch_dir.c_str());
+    }
+
+    this->scratch_dir.clear();
+    this->scratch_dir_owned = false;
+}
+
+void CentroiderHW::RunSimulation(const Mat &img)
+{
+    string dir = this->GetScratchDir();
+
+    StarFilterHW::WriteRawImage(img, dir + "/" CENTROIDER_HW_BUFFER_IMG_RAW);
+
+    // The arguments are passed without a shell (the Makefile quotes the file names)
+    vector<string> ghdl_cmd;
+
+    ghdl_cmd.push_back("make");
+    ghdl_cmd.push_back("centroider");
+    ghdl_cmd.push_back("STOP_TIME=" CENTROIDER_HW_SIM_MAX_TIME_US "us");
+    ghdl_cmd.push_back("THRESHOLD=" + to_string(StarFilterHW::ScaleThreshold(this->threshold, img)));
+    ghdl_cmd.push_back(StarFilterHW::MakeVariable("IMAGE_FILE", dir + "/" CENTROIDER_HW_BUFFER_IMG_RAW));
+    ghdl_cmd.push_back("RAW_INPUT=TRUE");
+    ghdl_cmd.push_back("IMG_WIDTH=" + to_string(img.cols));
+    ghdl_cmd.push_back("IMG_HEIGHT=" + to_string(img.rows));
+    ghdl_cmd.push_back("PIXEL_BITS=" + to_string(img.elemSize1()*8));
+    ghdl_cmd.push_back(StarFilterHW::MakeVariable("CENTROIDS_FILE", dir + "/" CENTROIDER_HW_BUFFER_CENTROIDS));
+    ghdl_cmd.push_back("MAX_CDPUS=" + to_string(this->max_cdpus));
+    ghdl_cmd.push_back("DISTANCE_THRESHOLD=" + to_string(this->distance_threshold));
+    ghdl_cmd.push_back("CORR_FACTOR=" + to_string(this->correction_factor));
+    ghdl_cmd.push_back("GATE=" + to_string((unsigned int)ceil(DISTANCE_THRESHOLD_MAN)));     // The same gate of the CDPUFixed class
+    ghdl_cmd.push_back("-C");
+    ghdl_cmd.push_back(STAR_FILTER_HW_VHDL_FILES_DIR);
+
+    ghdl_cmd.push_back("-s");       // Silent mode
+
+    int exit_code = Subprocess::Run(ghdl_cmd);
+
+    // The simulation always stops with a failed assertion (see StarFilterHW::RunSimulation), so it is checked by its log
+    if ((exit_code < 0) or (access((dir + "/" CENTROIDER_HW_BUFFER_CENTROIDS).c_str(), F_OK) != 0))
+    {
+        throw runtime_error("The GHDL simulation failed (exit code " + to_string(exit_code) + ") in " + string(__func__) + " method from " + __FILE__ + " file!");
+    }
+}
+
+vector<Centroid> CentroiderHW::ReadCentroidsFromFile(const string &file)
+{
+    vector<Centroid> centroids;
+
+    CSVRowCursor<unsigned int, 5> centroids_csv(file.c_str());
+
+    const double pos_scale = 1UL << CDPU_FIXED_DEFAULT_POS_BITS;
+
+    // The log has the state of each updated CDPU after each star pixel, so the last line of a CDPU is its final state
+    while(centroids_csv.Next())
+    {
+        unsigned int k = centroids_csv[CENTROIDER_HW_CENTROIDS_ROW_K];
+
+        if (k >= centroids.size())
+        {
+            centroids.resize(k + 1);
+        }
+
+        centroids[k] = Centroid(centroids_csv[CENTROIDER_HW_CENTROIDS_ROW_VAL],
+                                centroids_csv[CENTROIDER_HW_CENTROIDS_ROW_X]/pos_scale,
+                                centroids_csv[CENTROIDER_HW_CENTROIDS_ROW_Y]/pos_scale);
+
+        centroids[k].pixels = centroids_csv[CENTROIDER_HW_CENTROIDS_ROW_PIXELS];
+    }
+
+    return centroids;
+}
+
+//! \} End of centroider-hw group
@@ -0,0 +1,273 @@
+/*
+ * csv_writer.cpp
+ * 
+ * Copyright (C) 2020, Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ * 
+ * This file is part of CEST library.
+ * 
+ * CEST library is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * CEST library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with CEST library. If not, see <http://www.gnu.org/licenses/>.
+ * 
+ */
+
+/**
+ * \brief Buffered CSV writer implementation.
+ * 
+ * \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ * 
+ * \version 0.1.0
+ * 
+ * \date 18/10/2026
+ * 
+ * \addtogroup csv-writer
+ * \{
+ */
+
+#include <cmath>
+#include <cstring>
+#include <algorithm>
+#include <stdexcept>
+
+#include <cest/csv_writer.h>
+
+using namespace std;
+
+static const unsigned long long pow10_table[] = {1ULL, 10ULL, 100ULL, 1000ULL, 10000ULL, 100000ULL, 1000000ULL,
+                                                 10000000ULL, 100000000ULL, 1000000000ULL};
+
+CSVWriter::CSVWriter(size_t buffer_size)
+    : buffer(max(buffer_size, (size_t)CSV_WRITER_MAX_CELL_LENGTH*2))
+{
+    this->file      = NULL;
+    this->pos       = 0;
+    this->precision = CSV_WRITER_DEFAULT_PRECISION;
+    this->row_start = true;
+}
+
+CSVWriter::CSVWriter(const string &file_name, size_t buffer_size)
+    : CSVWriter(buffer_size)
+{
+    this->Open(file_name);
+}
+
+CSVWriter::~CSVWriter()
+{
+    // The destructor cannot throw, so a write error is ignored here
+    try
+    {
+        this->Close();
+    }
+    catch(...)
+    {
+
+    }
+}
+
+void CSVWriter::Open(const string &file_name, bool append)
+{
+    this->Close();
+
+    this->file = fopen(file_name.c_str(), append ? "ab" : "wb");
+
+    if (!this->file)
+    {
+        throw runtime_error("Error creating the output file in " + string(__func__) + " method from " + __FILE__ + " file!");
+    }
+
+    this->row_start = true;
+}
+
+void CSVWriter::Close()
+{
+    if (this->file)
+    {
+        this->Flush();
+
+        fclose(this->file);
+
+        this->file = NULL;
+    }
+}
+
+void CSVWriter::Flush()
+{
+    if (this->file and (this->pos > 0))
+    {
+        size_t len = this->pos;
+
+        this->pos = 0;
+
+        if (fwrite(this->buffer.data(), 1, len, this->file) != len)
+        {
+            throw runtime_error("Error writing the output file in " + string(__func__) + " method from " + __FILE__ + " file!");
+        }
+    }
+}
+
+void CSVWriter::SetPrecision(unsigned int p)
+{
+    this->precision = min(p, 9U);
+}
+
+void CSVWriter::BeginCell()
+{
+    if (!this->file)
+    {
+        throw runtime_error("No output file is open in " + string(__func__) + " method from " + __FILE__ + " file!");
+    }
+
+    if (this->buffer.size() - this->pos < CSV_WRITER_MAX_CELL_LENGTH)
+    {
+        this->Flush();
+    }
+
+    if (!this->row_start)
+    {
+        this->buffer[this->pos++] = ',';
+    }
+
+    this->row_start = false;
+}
+
+void CSVWriter::FormatUnsigned(unsigned long long val)
+{
+    char digits[20];
+    unsigned int n = 0;
+
+    do
+    {
+        digits[n++] = '0' + (val % 10);
+        val /= 10;
+    }
+    while(val > 0);
+
+    while(n > 0)
+    {
+        this->buffer[this->pos++] = digits[--n];
+    }
+}
+
+void CSVWriter::WriteCell(long long val)
+{
+    this->BeginCell();
+
+    if (val < 0)
+    {
+        this->buffer[this->pos++] = '-';
+
+        this->FormatUnsigned(0ULL - (unsigned long long)val);
+    }
+    else
+    {
+        this->FormatUnsigned(val);
+    }
+}
+
+void CSVWriter::WriteCell(unsigned long long val)
+{
+    this->BeginCell();
+
+    this->FormatUnsigned(val);
+}
+
+void CSVWriter::WriteCell(double val)
+{
+    this->BeginCell();
+
+    double scaled = fabs(val)*pow10_table[this->precision];
+
+    // Values out of the fixed-point range (and NaN/infinite values) are formatted by the C library
+    if (!(scaled < 1e18))
+    {
+        this->pos += snprintf(this->buffer.data() + this->pos, CSV_WRITER_MAX_CELL_LENGTH, "%.17g", val);
+
+        return;
+    }
+
+    unsigned long long fixed = llround(scaled);
+    unsigned long long int_part = fixed/pow10_table[this->precision];
+    unsigned long long frac_part = fixed%pow10_table[this->precision];
+
+    if (signbit(val) and (fixed > 0))
+    {
+        this->buffer[this->pos++] = '-';
+    }
+
+    this->FormatUnsigned(int_part);
+
+    if (frac_part > 0)
+    {
+        unsigned int decimals = this->precision;
+
+        // Trailing zeros are removed
+        while(frac_part % 10 == 0)
+        {
+            frac_part /= 10;
+            decimals--;
+        }
+
+        this->buffer[this->pos++] = '.';
+
+        for(unsigned int i=decimals; i>0; i--)
+        {
+            this->buffer[this->pos + i - 1] = '0' + (frac_part % 10);
+            frac_part /= 10;
+        }
+
+        this->pos += decimals;
+    }
+}
+
+void CSVWriter::WriteCell(const string &val)
+{
+    this->BeginCell();
+
+    // Long texts are written directly to the file
+    if (val.size() > this->buffer.size() - this->pos)
+    {
+        this->Flush();
+
+        if (val.size() > this->buffer.size())
+        {
+            if (this->file and (fwrite(val.data(), 1, val.size(), this->file) != val.size()))
+            {
+                throw runtime_error("Error writing the output file in " + string(__func__) + " method from " + __FILE__ + " file!");
+            }
+
+            return;
+        }
+    }
+
+    memcpy(this->buffer.data() + this->pos, val.data(), val.size());
+
+    this->pos += val.size();
+}
+
+void CSVWriter::EndRow()
+{
+    if (!this->file)
+    {
+        throw runtime_error("No output file is open in " + string(__func__) + " method from " + __FILE__ + " file!");
+    }
+
+    if (this->buffer.size() == this->pos)
+    {
+        this->Flush();
+    }
+
+    this->buffer[this->pos++] = '\n';
+
+    this->row_start = true;
+}
+
+//! \} End of csv-writer group
@@ -0,0 +1,185 @@
+/*
+ * frame_source.cpp
+ * 
+ * Copyright (C) 2020, Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ * 
+ * This file is part of CEST library.
+ * 
+ * CEST library is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * CEST library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with CEST library. If not, see <http://www.gnu.org/licenses/>.
+ * 
+ */
+
+/**
+ * \brief Frame source implementation.
+ * 
+ * \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ * 
+ * \version 0.1.0
+ * 
+ * \date 18/10/2026
+ * 
+ * \addtogroup frame-source
+ * \{
+ */
+
+#include <algorithm>
+#include <utility>
+
+#include <cest/frame_source.h>
+
+using namespace std;
+using namespace cv;
+
+FrameSource::FrameSource(unsigned int prefetch)
+    : ring(max(prefetch, 1U))
+{
+    this->head      = 0;
+    this->tail      = 0;
+    this->count     = 0;
+    this->frames    = 0;
+    this->started   = false;
+    this->stop      = false;
+    this->finished  = false;
+}
+
+FrameSource::~FrameSource()
+{
+    this->StopPrefetch();
+}
+
+bool FrameSource::Next(Mat &frame)
+{
+    if (!this->started)
+    {
+        this->started   = true;
+        this->stop      = false;
+        this->finished  = false;
+
+        this->prefetcher = thread(&FrameSource::Prefetch, this);
+    }
+
+    unique_lock<mutex> lock(this->ring_mutex);
+
+    this->not_empty.wait(lock, [this]{ return (this->count > 0) or this->finished; });
+
+    if (this->count == 0)
+    {
+        if (this->error)
+        {
+            exception_ptr e = this->error;
+
+            this->error = nullptr;
+
+            rethrow_exception(e);
+        }
+
+        return false;
+    }
+
+    // The buffer of the caller goes back to the ring
+    swap(frame, this->ring[this->tail]);
+
+    this->tail = (this->tail + 1) % this->ring.size();
+    this->count--;
+    this->frames++;
+
+    lock.unlock();
+
+    this->not_full.notify_one();
+
+    return true;
+}
+
+unsigned long FrameSource::GetFrameIndex()
+{
+    return this->frames;
+}
+
+void FrameSource::StopPrefetch()
+{
+    {
+        lock_guard<mutex> lock(this->ring_mutex);
+
+        this->stop = true;
+    }
+
+    this->not_full.notify_all();
+
+    if (this->prefetcher.joinable())
+    {
+        this->prefetcher.join();
+    }
+
+    this->head      = 0;
+    this->tail      = 0;
+    this->count     = 0;
+    this->frames    = 0;
+    this->started   = false;
+    this->finished  = false;
+    this->error     = nullptr;
+}
+
+void FrameSource::Prefetch()
+{
+    unique_lock<mutex> lock(this->ring_mutex);
+
+    while(true)
+    {
+        this->not_full.wait(lock, [this]{ return this->stop or (this->count < this->ring.size()); });
+
+        if (this->stop)
+        {
+            break;
+        }
+
+        // The head buffer is not visible to the calling thread while the ring is not full
+        Mat &slot = this->ring[this->head];
+
+        lock.unlock();
+
+        bool ok = false;
+        exception_ptr e;
+
+        try
+        {
+            ok = this->ReadFrame(slot);
+        }
+        catch(...)
+        {
+            e = current_exception();
+        }
+
+        lock.lock();
+
+        if (!ok)
+        {
+            this->error = e;
+
+            break;
+        }
+
+        this->head = (this->head + 1) % this->ring.size();
+        this->count++;
+
+        this->not_empty.notify_one();
+    }
+
+    this->finished = true;
+
+    lock.unlock();
+
+    this->not_empty.notify_all();
+}
+
+//! \} End of frame-source group
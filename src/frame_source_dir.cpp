@@ -0,0 +1,110 @@
+/*
+ * frame_source_dir.cpp
+ * 
+ * Copyright (C) 2020, Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ * 
+ * This file is part of CEST library.
+ * 
+ * CEST library is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * CEST library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with CEST library. If not, see <http://www.gnu.org/licenses/>.
+ * 
+ */
+
+/**
+ * \brief Frame source (image directory) implementation.
+ * 
+ * \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ * 
+ * \version 0.1.0
+ * 
+ * \date 18/10/2026
+ * 
+ * \addtogroup frame-source-dir
+ * \{
+ */
+
+#include <algorithm>
+#include <stdexcept>
+
+#include <cest/frame_source_dir.h>
+#include <cest/mapped_frame.h>
+
+using namespace std;
+using namespace cv;
+
+FrameSourceDir::FrameSourceDir(const string &dir, int flags, unsigned int prefetch)
+    : FrameSource(prefetch)
+{
+    this->flags     = flags;
+    this->next_file = 0;
+
+    this->Open(dir);
+}
+
+FrameSourceDir::~FrameSourceDir()
+{
+    this->StopPrefetch();
+}
+
+void FrameSourceDir::Open(const string &dir)
+{
+    this->StopPrefetch();
+
+    glob(dir + "/*", this->files, false);
+
+    sort(this->files.begin(), this->files.end());
+
+    this->next_file = 0;
+}
+
+vector<string> FrameSourceDir::GetFiles()
+{
+    return this->files;
+}
+
+long FrameSourceDir::GetNumberOfFrames()
+{
+    return this->files.size();
+}
+
+bool FrameSourceDir::ReadFrame(Mat &frame)
+{
+    if (this->next_file == this->files.size())
+    {
+        return false;
+    }
+
+    const string &file = this->files[this->next_file++];
+
+    // Only 8-bit binary PGM images can be used as they are (the other ones, as ASCII or 16-bit files, are decoded by
+    // cv::imread()), so the header is checked before mapping the file
+    if (MappedFrame::IsPNM(file) and (MappedFrame::GetPNMType(file) == CV_8UC1))
+    {
+        MappedFrame mapped(file);
+
+        mapped.GetImage().copyTo(frame);
+
+        return true;
+    }
+
+    frame = imread(file, this->flags);
+
+    if (frame.empty())
+    {
+        throw runtime_error("Impossible to read the image file \"" + file + "\" in " + string(__func__) + " method from " + __FILE__ + " file!");
+    }
+
+    return true;
+}
+
+//! \} End of frame-source-dir group
@@ -0,0 +1,141 @@
+/*
+ * frame_source_raw.cpp
+ * 
+ * Copyright (C) 2020, Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ * 
+ * This file is part of CEST library.
+ * 
+ * CEST library is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * CEST library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with CEST library. If not, see <http://www.gnu.org/licenses/>.
+ * 
+ */
+
+/**
+ * \brief Frame source (raw multi-frame file) implementation.
+ * 
+ * \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ * 
+ * \version 0.1.0
+ * 
+ * \date 18/10/2026
+ * 
+ * \addtogroup frame-source-raw
+ * \{
+ */
+
+#include <stdexcept>
+
+#include <sys/stat.h>
+
+#include <cest/frame_source_raw.h>
+
+using namespace std;
+using namespace cv;
+
+FrameSourceRaw::FrameSourceRaw(const string &file, int width, int height, int type, unsigned int prefetch)
+    : FrameSource(prefetch)
+{
+    this->file      = NULL;
+    this->width     = 0;
+    this->height    = 0;
+    this->type      = CV_8UC1;
+    this->frames    = 0;
+
+    this->Open(file, width, height, type);
+}
+
+FrameSourceRaw::~FrameSourceRaw()
+{
+    this->StopPrefetch();
+
+    this->CloseFile();
+}
+
+void FrameSourceRaw::Open(const string &file, int width, int height, int type)
+{
+    if ((type != CV_8UC1) and (type != CV_16UC1))
+    {
+        throw invalid_argument("Only 8-bit and 16-bit single channel frames are supported in " + string(__func__) + " method from " + __FILE__ + " file!");
+    }
+
+    if ((width <= 0) or (height <= 0))
+    {
+        throw invalid_argument("Invalid frame size in " + string(__func__) + " method from " + __FILE__ + " file!");
+    }
+
+    this->StopPrefetch();
+
+    this->CloseFile();
+
+    this->file = fopen(file.c_str(), "rb");
+
+    if (!this->file)
+    {
+        throw runtime_error("Error opening the raw file in " + string(__func__) + " method from " + __FILE__ + " file!");
+    }
+
+    struct stat st;
+
+    if (fstat(fileno(this->file), &st) != 0)
+    {
+        this->CloseFile();
+
+        throw runtime_error("fstat() failed in " + string(__func__) + " method from " + __FILE__ + " file!");
+    }
+
+    this->width     = width;
+    this->height    = height;
+    this->type      = type;
+    this->frames    = st.st_size/(size_t(width)*height*((type == CV_16UC1) ? 2 : 1));
+}
+
+long FrameSourceRaw::GetNumberOfFrames()
+{
+    return this->frames;
+}
+
+void FrameSourceRaw::CloseFile()
+{
+    if (this->file)
+    {
+        fclose(this->file);
+
+        this->file = NULL;
+    }
+
+    this->frames = 0;
+}
+
+bool FrameSourceRaw::ReadFrame(Mat &frame)
+{
+    if (!this->file)
+    {
+        return false;
+    }
+
+    // The buffer is only reallocated if the size or the type changed
+    frame.create(this->height, this->width, this->type);
+
+    size_t len = frame.total()*frame.elemSize();
+
+    size_t n = fread(frame.data, 1, len, this->file);
+
+    if ((n < len) and ferror(this->file))
+    {
+        throw runtime_error("Error reading the raw file in " + string(__func__) + " method from " + __FILE__ + " file!");
+    }
+
+    return n == len;
+}
+
+//! \} End of frame-source-raw group
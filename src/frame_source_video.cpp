@@ -0,0 +1,96 @@
+/*
+ * frame_source_video.cpp
+ * 
+ * Copyright (C) 2020, Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ * 
+ * This file is part of CEST library.
+ * 
+ * CEST library is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * CEST library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with CEST library. If not, see <http://www.gnu.org/licenses/>.
+ * 
+ */
+
+/**
+ * \brief Frame source (video) implementation.
+ * 
+ * \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ * 
+ * \version 0.1.0
+ * 
+ * \date 18/10/2026
+ * 
+ * \addtogroup frame-source-video
+ * \{
+ */
+
+#include <cctype>
+#include <algorithm>
+#include <stdexcept>
+
+#include <cest/frame_source_video.h>
+
+using namespace std;
+using namespace cv;
+
+FrameSourceVideo::FrameSourceVideo(const string &source, unsigned int prefetch)
+    : FrameSource(prefetch)
+{
+    this->frames = -1;
+
+    this->Open(source);
+}
+
+FrameSourceVideo::~FrameSourceVideo()
+{
+    this->StopPrefetch();
+}
+
+void FrameSourceVideo::Open(const string &source)
+{
+    this->StopPrefetch();
+
+    this->capture.release();
+
+    bool camera = !source.empty() and all_of(source.begin(), source.end(), [](char c){ return isdigit((unsigned char)c); });
+
+    if (camera)
+    {
+        this->capture.open(stoi(source));
+    }
+    else
+    {
+        this->capture.open(source);
+    }
+
+    if (!this->capture.isOpened())
+    {
+        throw runtime_error("Error opening the video \"" + source + "\" in " + string(__func__) + " method from " + __FILE__ + " file!");
+    }
+
+    // Read here, since the capture is only used by the prefetch thread after the sequence starts
+    long n = this->capture.get(CAP_PROP_FRAME_COUNT);
+
+    this->frames = (n > 0) ? n : -1;
+}
+
+long FrameSourceVideo::GetNumberOfFrames()
+{
+    return this->frames;
+}
+
+bool FrameSourceVideo::ReadFrame(Mat &frame)
+{
+    return this->capture.read(frame);
+}
+
+//! \} End of frame-source-video group
@@ -0,0 +1,306 @@
+/*
+ * mapped_frame.cpp
+ * 
+ * Copyright (C) 2020, Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ * 
+ * This file is part of CEST library.
+ * 
+ * CEST library is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * CEST library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with CEST library. If not, see <http://www.gnu.org/licenses/>.
+ * 
+ */
+
+/**
+ * \brief Memory-mapped frame implementation.
+ * 
+ * \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ * 
+ * \version 0.1.0
+ * 
+ * \date 18/10/2026
+ * 
+ * \addtogroup mapped-frame
+ * \{
+ */
+
+#include <cctype>
+#include <stdint.h>
+#include <algorithm>
+#include <stdexcept>
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include <cest/mapped_frame.h>
+
+using namespace std;
+using namespace cv;
+
+MappedFrame::MappedFrame()
+{
+    this->map       = NULL;
+    this->map_len   = 0;
+}
+
+MappedFrame::MappedFrame(const string &file)
+    : MappedFrame()
+{
+    this->Open(file);
+}
+
+MappedFrame::~MappedFrame()
+{
+    this->Close();
+}
+
+void MappedFrame::Open(const string &file)
+{
+    this->Map(file);
+
+    int width, height, max_val, channels;
+
+    size_t offset = ParsePNMHeader(static_cast<const char*>(this->map), this->map_len, width, height, max_val, channels);
+
+    if (offset == 0)
+    {
+        this->Close();
+
+        throw runtime_error("Invalid image header (only binary PGM and PPM files are supported) in " + string(__func__) + " method from " + __FILE__ + " file!");
+    }
+
+    size_t px_size = (max_val < 256) ? 1 : 2;
+    size_t len = size_t(width)*height*channels*px_size;
+
+    if (this->map_len - offset < len)
+    {
+        this->Close();
+
+        throw runtime_error("Incomplete image file in " + string(__func__) + " method from " + __FILE__ + " file!");
+    }
+
+    uchar *pixels = static_cast<uchar*>(this->map) + offset;
+
+    if (px_size == 1)
+    {
+        this->frame = Mat(height, width, CV_MAKETYPE(CV_8U, channels), pixels);
+    }
+    else
+    {
+        // 16-bit pixels are big-endian in the PNM files
+        Mat img(height, width, CV_MAKETYPE(CV_16U, channels));
+
+        uint16_t *dst = reinterpret_cast<uint16_t*>(img.data);
+
+        for(size_t i=0; i<len/2; i++)
+        {
+            dst[i] = (uint16_t(pixels[2*i]) << 8) | pixels[2*i + 1];
+        }
+
+        munmap(this->map, this->map_len);
+
+        this->map       = NULL;
+        this->map_len   = 0;
+        this->frame     = img;
+    }
+}
+
+void MappedFrame::OpenRaw(const string &file, int width, int height, int type)
+{
+    if ((type != CV_8UC1) and (type != CV_16UC1))
+    {
+        throw invalid_argument("Only 8-bit and 16-bit single channel images are supported in " + string(__func__) + " method from " + __FILE__ + " file!");
+    }
+
+    if ((width <= 0) or (height <= 0))
+    {
+        throw invalid_argument("Invalid image size in " + string(__func__) + " method from " + __FILE__ + " file!");
+    }
+
+    this->Map(file);
+
+    size_t len = size_t(width)*height*((type == CV_16UC1) ? 2 : 1);
+
+    if (this->map_len < len)
+    {
+        this->Close();
+
+        throw runtime_error("Incomplete image file in " + string(__func__) + " method from " + __FILE__ + " file!");
+    }
+
+    this->frame = Mat(height, width, type, this->map);
+}
+
+void MappedFrame::Close()
+{
+    this->frame = Mat();
+
+    if (this->map)
+    {
+        munmap(this->map, this->map_len);
+    }
+
+    this->map       = NULL;
+    this->map_len   = 0;
+}
+
+Mat MappedFrame::GetImage() const
+{
+    return this->frame;
+}
+
+bool MappedFrame::IsPNM(const string &file)
+{
+    size_t dot = file.find_last_of('.');
+
+    if (dot == string::npos)
+    {
+        return false;
+    }
+
+    string ext = file.substr(dot + 1);
+
+    transform(ext.begin(), ext.end(), ext.begin(), ::tolower);
+
+    return (ext == "pgm") or (ext == "ppm") or (ext == "pnm");
+}
+
+int MappedFrame::GetPNMType(const string &file)
+{
+    int fd = open(file.c_str(), O_RDONLY | O_CLOEXEC);
+
+    if (fd < 0)
+    {
+        return -1;
+    }
+
+    char header[MAPPED_FRAME_MAX_HEADER_LENGTH];
+
+    ssize_t len = read(fd, header, sizeof(header));
+
+    close(fd);
+
+    int width, height, max_val, channels;
+
+    if ((len <= 0) or (ParsePNMHeader(header, len, width, height, max_val, channels) == 0))
+    {
+        return -1;
+    }
+
+    return CV_MAKETYPE((max_val < 256) ? CV_8U : CV_16U, channels);
+}
+
+void MappedFrame::Map(const string &file)
+{
+    this->Close();
+
+    int fd = open(file.c_str(), O_RDONLY | O_CLOEXEC);
+
+    if (fd < 0)
+    {
+        throw runtime_error("Error opening the image file in " + string(__func__) + " method from " + __FILE__ + " file!");
+    }
+
+    struct stat st;
+
+    if (fstat(fd, &st) != 0)
+    {
+        close(fd);
+
+        throw runtime_error("fstat() failed in " + string(__func__) + " method from " + __FILE__ + " file!");
+    }
+
+    if (st.st_size == 0)
+    {
+        close(fd);
+
+        throw runtime_error("Empty image file in " + string(__func__) + " method from " + __FILE__ + " file!");
+    }
+
+    // The mapping is copy-on-write, so the image can be modified without changing the file
+    void *addr = mmap(NULL, st.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+
+    close(fd);
+
+    if (addr == MAP_FAILED)
+    {
+        throw runtime_error("mmap() failed in " + string(__func__) + " method from " + __FILE__ + " file!");
+    }
+
+    madvise(addr, st.st_size, MADV_SEQUENTIAL);
+
+    this->map       = addr;
+    this->map_len   = st.st_size;
+}
+
+size_t MappedFrame::ParsePNMHeader(const char *data, size_t len, int &width, int &height, int &max_val, int &channels)
+{
+    size_t pos = 2;
+
+    len = min(len, size_t(MAPPED_FRAME_MAX_HEADER_LENGTH));
+
+    if ((len < 2) or (data[0] != 'P') or ((data[1] != '5') and (data[1] != '6')))
+    {
+        return 0;
+    }
+
+    channels = (data[1] == '5') ? 1 : 3;
+
+    int fields[3];
+
+    // Width, height and maximum value, separated by whitespaces and comments
+    for(unsigned int f=0; f<3; f++)
+    {
+        while((pos < len) and (isspace((unsigned char)data[pos]) or (data[pos] == '#')))
+        {
+            if (data[pos] == '#')
+            {
+                while((pos < len) and (data[pos] != '\n'))
+                {
+                    pos++;
+                }
+            }
+            else
+            {
+                pos++;
+            }
+        }
+
+        if ((pos == len) or !isdigit((unsigned char)data[pos]))
+        {
+            return 0;
+        }
+
+        fields[f] = 0;
+
+        while((pos < len) and isdigit((unsigned char)data[pos]) and (fields[f] < 1000000))
+        {
+            fields[f] = fields[f]*10 + (data[pos++] - '0');
+        }
+    }
+
+    // A single whitespace before the pixels
+    if ((pos == len) or !isspace((unsigned char)data[pos]) or (fields[0] == 0) or (fields[1] == 0) or (fields[2] == 0) or (fields[2] > 65535))
+    {
+        return 0;
+    }
+
+    width   = fields[0];
+    height  = fields[1];
+    max_val = fields[2];
+
+    return pos + 1;
+}
+
+//! \} End of mapped-frame group
@@ -0,0 +1,259 @@
+/*
+ * pipeline.cpp
+ * 
+ * Copyright (C) 2020, Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ * 
+ * This file is part of CEST library.
+ * 
+ * CEST library is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * CEST library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with CEST library. If not, see <http://www.gnu.org/licenses/>.
+ * 
+ */
+
+/**
+ * \brief Frame processing pipeline implementation.
+ * 
+ * \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ * 
+ * \version 0.1.0
+ * 
+ * \date 18/10/2026
+ * 
+ * \addtogroup pipeline
+ * \{
+ */
+
+#include <thread>
+#include <chrono>
+#include <utility>
+#include <algorithm>
+
+#include <cest/pipeline.h>
+
+#define PIPELINE_SPIN_ITERATIONS        64      /**< Polls of an empty queue before yielding the CPU. */
+#define PIPELINE_YIELD_ITERATIONS       1024    /**< Polls of an empty queue before sleeping. */
+#define PIPELINE_SLEEP_TIME_US          50      /**< Sleep time between the polls of an idle queue. */
+
+using namespace std;
+using namespace cv;
+using namespace cest;
+
+Pipeline::Pipeline(StarFilter *star_filter, Centroider *centroider, unsigned int depth)
+{
+    this->star_filter       = star_filter;
+    this->centroider        = centroider;
+    this->correction_factor = CENTROIDER_CDPU_DEFAULT_CORRECTION_FACTOR;
+    this->sort_centroids    = true;
+    this->abort             = false;
+
+    this->SetDepth(depth);
+}
+
+void Pipeline::SetCorrectionFactor(float a)
+{
+    this->correction_factor = a;
+}
+
+void Pipeline::SetSortCentroids(bool en)
+{
+    this->sort_centroids = en;
+}
+
+void Pipeline::SetDepth(unsigned int n)
+{
+    this->depth = max(n, (unsigned int)PIPELINE_MIN_DEPTH);
+}
+
+unsigned long Pipeline::Run(FrameSource &source, const function<void(const PipelineFrame&)> &output)
+{
+    vector<PipelineFrame> frames(this->depth);
+
+    // Each queue fits all the frames and the end of sequence mark, so a push never fails
+    FrameQueue free_frames(this->depth + 1);
+    FrameQueue filter_queue(this->depth + 1);
+    FrameQueue centroider_queue(this->depth + 1);
+    FrameQueue output_queue(this->depth + 1);
+
+    for(unsigned int i=0; i<this->depth; i++)
+    {
+        free_frames.Push(&frames[i]);
+    }
+
+    this->abort = false;
+    this->error = nullptr;
+
+    thread acquire_thread(&Pipeline::AcquireStage, this, ref(source), ref(free_frames), ref(filter_queue));
+    thread filter_thread(&Pipeline::FilterStage, this, ref(filter_queue), ref(centroider_queue));
+    thread centroider_thread(&Pipeline::CentroiderStage, this, ref(centroider_queue), ref(output_queue));
+
+    // Output stage (in the calling thread)
+    unsigned long processed = 0;
+    PipelineFrame *frame;
+
+    while(this->WaitFrame(output_queue, frame) and frame)
+    {
+        try
+        {
+            output(*frame);
+        }
+        catch(...)
+        {
+            this->Fail();
+
+            break;
+        }
+
+        processed++;
+
+        free_frames.Push(frame);
+    }
+
+    acquire_thread.join();
+    filter_thread.join();
+    centroider_thread.join();
+
+    if (this->error)
+    {
+        rethrow_exception(this->error);
+    }
+
+    return processed;
+}
+
+void Pipeline::Fail()
+{
+    lock_guard<mutex> lock(this->error_mutex);
+
+    if (!this->error)
+    {
+        this->error = current_exception();
+    }
+
+    this->abort = true;
+}
+
+bool Pipeline::WaitFrame(FrameQueue &queue, PipelineFrame *&frame)
+{
+    unsigned int polls = 0;
+
+    while(!queue.Pop(frame))
+    {
+        if (this->abort)
+        {
+            return false;
+        }
+
+        // Busy wait for short stalls, and sleep when the previous stage is much slower
+        polls++;
+
+        if (polls > PIPELINE_YIELD_ITERATIONS)
+        {
+            this_thread::sleep_for(chrono::microseconds(PIPELINE_SLEEP_TIME_US));
+        }
+        else if (polls > PIPELINE_SPIN_ITERATIONS)
+        {
+            this_thread::yield();
+        }
+    }
+
+    return true;
+}
+
+void Pipeline::AcquireStage(FrameSource &source, FrameQueue &in, FrameQueue &out)
+{
+    unsigned long index = 0;
+    PipelineFrame *frame;
+
+    try
+    {
+        while(this->WaitFrame(in, frame))
+        {
+            // The image buffer of the frame goes back to the source, since the frame was released by the output stage
+            if (!source.Next(frame->image))
+            {
+                out.Push(nullptr);
+
+                return;
+            }
+
+            frame->index = index++;
+
+            out.Push(frame);
+        }
+    }
+    catch(...)
+    {
+        this->Fail();
+    }
+}
+
+void Pipeline::FilterStage(FrameQueue &in, FrameQueue &out)
+{
+    PipelineFrame *frame;
+
+    try
+    {
+        while(this->WaitFrame(in, frame))
+        {
+            if (frame)
+            {
+                this->star_filter->GetStarPixels(frame->image, frame->star_pixels);
+            }
+
+            out.Push(frame);
+
+            if (!frame)
+            {
+                return;
+            }
+        }
+    }
+    catch(...)
+    {
+        this->Fail();
+    }
+}
+
+void Pipeline::CentroiderStage(FrameQueue &in, FrameQueue &out)
+{
+    PipelineFrame *frame;
+
+    try
+    {
+        while(this->WaitFrame(in, frame))
+        {
+            if (frame)
+            {
+                this->centroider->ComputeFromList(frame->star_pixels, frame->centroids, this->correction_factor);
+
+                if (this->sort_centroids)
+                {
+                    frame->centroids = this->centroider->SortCentroids(move(frame->centroids));
+                }
+            }
+
+            out.Push(frame);
+
+            if (!frame)
+            {
+                return;
+            }
+        }
+    }
+    catch(...)
+    {
+        this->Fail();
+    }
+}
+
+//! \} End of pipeline group
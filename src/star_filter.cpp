@@ -33,6 +33,9 @@
  * \{
  */
 
+#include <string>
+#include <stdexcept>
+
 #include <cest/star_filter.h>
 
 using namespace std;
@@ -59,9 +62,73 @@ uint8_t StarFilter::GetThreshold()
     return this->threshold;
 }
 
-vector<StarPixel> StarFilter::GetStarPixels(Mat img)
+vector<StarPixel> StarFilter::GetStarPixels(const Mat &img)
 {
     return vector<StarPixel>();
 }
 
+void StarFilter::GetStarPixels(const Mat &img, vector<StarPixel> &star_pixels)
+{
+    vector<StarPixel> pixels = this->GetStarPixels(img);
+
+    star_pixels.assign(pixels.begin(), pixels.end());
+}
+
+void StarFilter::GetStarPixels(const Mat &img, StarPixelBuffer &star_pixels)
+{
+    this->CheckBufferImageSize(img);
+
+    vector<StarPixel> pixels = this->GetStarPixels(img);
+
+    star_pixels.Clear();
+    star_pixels.Reserve(pixels.size());
+
+    for(unsigned int i=0; i<pixels.size(); i++)
+    {
+        star_pixels.Append(pixels[i].value, pixels[i].x, pixels[i].y);
+    }
+}
+
+void StarFilter::GetStarSpans(const Mat &img, vector<StarPixelSpan> &spans)
+{
+    vector<StarPixel> pixels = this->GetStarPixels(img);
+
+    spans.clear();
+
+    // The values are taken from the filter output (not from the image), so the spans are the same of the star pixels
+    // of any filter (as the HW simulation, which also repeats some pixels)
+    this->span_values.resize(pixels.size());
+
+    for(unsigned int i=0; i<pixels.size(); i++)
+    {
+        this->span_values[i] = pixels[i].value;
+    }
+
+    for(unsigned int i=0; i<pixels.size(); i++)
+    {
+        if (!spans.empty() and (spans.back().row == pixels[i].y) and (spans.back().x_end+1 == pixels[i].x))
+        {
+            spans.back().x_end++;
+        }
+        else
+        {
+            spans.push_back(StarPixelSpan(pixels[i].y, pixels[i].x, pixels[i].x, &this->span_values[i]));
+        }
+    }
+}
+
+void StarFilter::CheckBufferImageSize(const Mat &img)
+{
+    if ((img.cols > STAR_PIXEL_BUFFER_MAX_IMAGE_SIZE) or (img.rows > STAR_PIXEL_BUFFER_MAX_IMAGE_SIZE))
+    {
+        string error_text = "Image too large for a star pixel buffer in ";
+        error_text += __func__;
+        error_text += " method from ";
+        error_text += __FILE__;
+        error_text += " file!";
+
+        throw runtime_error(error_text.c_str());
+    }
+}
+
 //! \} End of star-filter group
@@ -34,101 +34,758 @@
  */
 
 #include <cstdio>
+#include <cstdlib>
+#include <cerrno>
 #include <algorithm>
 #include <memory>
+#include <functional>
+#include <thread>
+#include <chrono>
+#include <atomic>
+#include <exception>
+#include <stdexcept>
+
+#include <unistd.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <signal.h>
+#include <pthread.h>
+#include <sys/stat.h>
 
 #include <cest/star_filter_hw.h>
-#include <cest/csv.hpp>
+#include <cest/star_pixel_log.h>
+#include <cest/csv_cursor.hpp>
 
 using namespace std;
 using namespace cv;
 using namespace cest;
 
-StarFilterHW::StarFilterHW()
-    : StarFilter()
+/**
+ * \brief Gets the time of a monotonic clock.
+ *
+ * \return The current time in milliseconds.
+ */
+static long long NowMs()
+{
+    return chrono::duration_cast<chrono::milliseconds>(chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+/**
+ * \brief Writes to a FIFO without raising SIGPIPE.
+ *
+ * The signal is only blocked in the calling thread during the write, and a SIGPIPE raised by it is discarded, so a closed
+ * FIFO gives an EPIPE error without changing the signal handling of the process.
+ *
+ * \param[in] fd is the FIFO file descriptor.
+ *
+ * \param[in] data is the data to write.
+ *
+ * \param[in] len is the number of bytes to write.
+ *
+ * \return The number of written bytes, or -1 on error (see errno).
+ */
+static ssize_t WriteNoSignal(int fd, const void *data, size_t len)
 {
+    sigset_t pipe_set, old_set, pending;
+
+    sigemptyset(&pipe_set);
+    sigaddset(&pipe_set, SIGPIPE);
+
+    pthread_sigmask(SIG_BLOCK, &pipe_set, &old_set);
+
+    sigpending(&pending);
+
+    bool was_pending = sigismember(&pending, SIGPIPE);
+
+    ssize_t n = write(fd, data, len);
+
+    if ((n < 0) and (errno == EPIPE) and !was_pending)
+    {
+        struct timespec no_wait = {0, 0};
+
+        sigtimedwait(&pipe_set, NULL, &no_wait);
 
+        errno = EPIPE;
+    }
+
+    pthread_sigmask(SIG_SETMASK, &old_set, NULL);
+
+    return n;
+}
+
+/**
+ * \brief Parses a line of the star pixels FIFO of the simulation server.
+ *
+ * \param[in] line is the line ("value,x,y").
+ *
+ * \param[in] star_pixels is the list to append the star pixel.
+ *
+ * \return None.
+ */
+static void ParseServerLine(const string &line, vector<StarPixel> &star_pixels)
+{
+    unsigned int val, x, y;
+
+    if (sscanf(line.c_str(), "%u,%u,%u", &val, &x, &y) == 3)
+    {
+        star_pixels.push_back(StarPixel(val, x, y));
+    }
+}
+
+StarFilterHW::StarFilterHW()
+    : StarFilter(), pool(STAR_FILTER_HW_DEFAULT_THREADS)
+{
+    this->server_mode       = STAR_FILTER_HW_DEFAULT_SERVER_MODE;
+    this->binary_log        = STAR_FILTER_HW_DEFAULT_BINARY_LOG;
+    this->raw_input         = STAR_FILTER_HW_DEFAULT_RAW_INPUT;
+    this->server_cmd_fd     = -1;
+    this->scratch_dir_owned = false;
 }
 
 StarFilterHW::StarFilterHW(uint8_t thr)
+    : StarFilter(), pool(STAR_FILTER_HW_DEFAULT_THREADS)
 {
+    this->server_mode       = STAR_FILTER_HW_DEFAULT_SERVER_MODE;
+    this->binary_log        = STAR_FILTER_HW_DEFAULT_BINARY_LOG;
+    this->raw_input         = STAR_FILTER_HW_DEFAULT_RAW_INPUT;
+    this->server_cmd_fd     = -1;
+    this->scratch_dir_owned = false;
+
     this->SetThreshold(thr);
 }
 
 StarFilterHW::~StarFilterHW()
 {
+    this->StopServer();
 
+    this->RemoveScratchDir();
 }
 
 void StarFilterHW::Clear()
 {
-    system("rm -f " STAR_FILTER_HW_BUFFER_IMG);
-    system("rm -f " STAR_FILTER_HW_BUFFER_STAR_PIXELS);
+    if (!this->scratch_dir.empty())
+    {
+        unlink((this->scratch_dir + "/" STAR_FILTER_HW_BUFFER_IMG).c_str());
+        unlink((this->scratch_dir + "/" STAR_FILTER_HW_BUFFER_IMG_RAW).c_str());
+        unlink((this->scratch_dir + "/" STAR_FILTER_HW_BUFFER_STAR_PIXELS).c_str());
+        unlink((this->scratch_dir + "/" STAR_FILTER_HW_BUFFER_STAR_PIXELS_BIN).c_str());
+    }
 }
 
-vector<StarPixel> StarFilterHW::GetStarPixels(Mat img)
+vector<StarPixel> StarFilterHW::GetStarPixels(const Mat &img)
 {
+    if (this->server_mode)
+    {
+        return this->RunServerFrame(img);
+    }
+
     this->Clear();
 
     this->RunSimulation(img);
 
-    return this->ReadStarPixelsFromFile(STAR_FILTER_HW_BUFFER_STAR_PIXELS);
+    if (this->binary_log)
+    {
+        vector<StarPixel> star_pixels;
+
+        StarPixelLog(this->GetScratchDir() + "/" STAR_FILTER_HW_BUFFER_STAR_PIXELS_BIN).GetStarPixels(star_pixels);
+
+        return star_pixels;
+    }
+
+    return this->ReadStarPixelsFromFile(this->GetScratchDir() + "/" STAR_FILTER_HW_BUFFER_STAR_PIXELS);
 }
 
-vector<StarPixel> StarFilterHW::GetStarPixels(Mat img, uint8_t thr)
+void StarFilterHW::VisitStarPixels(const Mat &img, const function<void(const StarPixel&)> &visitor)
+{
+    if (this->server_mode)
+    {
+        vector<StarPixel> star_pixels = this->RunServerFrame(img);
+
+        for_each(star_pixels.begin(), star_pixels.end(), visitor);
+
+        return;
+    }
+
+    this->Clear();
+
+    this->RunSimulation(img);
+
+    if (this->binary_log)
+    {
+        // The binary log is memory-mapped, so its records are read in place
+        StarPixelLog star_pixel_log(this->GetScratchDir() + "/" STAR_FILTER_HW_BUFFER_STAR_PIXELS_BIN);
+
+        for(size_t i=0; i<star_pixel_log.GetSize(); i++)
+        {
+            visitor(star_pixel_log[i]);
+        }
+
+        return;
+    }
+
+    this->ReadStarPixelsFromFile(this->GetScratchDir() + "/" STAR_FILTER_HW_BUFFER_STAR_PIXELS, visitor);
+}
+
+vector<StarPixel> StarFilterHW::GetStarPixels(const Mat &img, uint8_t thr)
 {
     this->SetThreshold(thr);
 
     return this->GetStarPixels(img);
 }
 
+void StarFilterHW::GetStarPixels(const vector<Mat> &imgs, vector<vector<StarPixel> > &star_pixels)
+{
+    star_pixels.clear();
+    star_pixels.resize(imgs.size());
+
+    unsigned int sims = min(this->GetNumberOfThreads(), (unsigned int)imgs.size());
+
+    // Each parallel simulation needs its own scratch directory
+    while(this->batch_sims.size() < sims)
+    {
+        this->batch_sims.push_back(unique_ptr<StarFilterHW>(new StarFilterHW));
+    }
+
+    atomic<unsigned int> next_img(0);
+    vector<exception_ptr> errors(sims);
+
+    this->pool.Run(sims, [this, &imgs, &star_pixels, &next_img, &errors](unsigned int s)
+        {
+            StarFilterHW *sim = this->batch_sims[s].get();
+
+            sim->SetThreshold(this->GetThreshold());
+            sim->SetServerMode(this->GetServerMode());
+            sim->SetBinaryLog(this->GetBinaryLog());
+            sim->SetRawInput(this->GetRawInput());
+
+            try
+            {
+                for(unsigned int i=next_img++; i<imgs.size(); i=next_img++)
+                {
+                    star_pixels[i] = sim->GetStarPixels(imgs[i]);
+                }
+            }
+            catch(...)
+            {
+                errors[s] = current_exception();
+            }
+        });
+
+    for(unsigned int s=0; s<sims; s++)
+    {
+        if (errors[s])
+        {
+            rethrow_exception(errors[s]);
+        }
+    }
+}
+
 void StarFilterHW::SetThreshold(uint8_t val)
 {
     this->threshold = val;
 }
 
-void StarFilterHW::RunSimulation(Mat img)
+void StarFilterHW::SetServerMode(bool en)
 {
-    imwrite(STAR_FILTER_HW_BUFFER_IMG, img, vector<int>(IMWRITE_PXM_BINARY));
+    this->server_mode = en;
 
-    string ghdl_cmd = "make";
+    if (!en)
+    {
+        this->StopServer();
+    }
+}
 
-    ghdl_cmd += " STOP_TIME=";
-    ghdl_cmd += STAR_FILTER_HW_SIM_MAX_TIME_US;
-    ghdl_cmd += "us";
+bool StarFilterHW::GetServerMode()
+{
+    return this->server_mode;
+}
 
-    ghdl_cmd += " THRESHOLD=";
-    ghdl_cmd += to_string(this->GetThreshold());
-    ghdl_cmd += " -C ";
-    ghdl_cmd += STAR_FILTER_HW_VHDL_FILES_DIR;
+void StarFilterHW::SetBinaryLog(bool en)
+{
+    this->binary_log = en;
+}
 
-    ghdl_cmd += " -s -i";       // Silent mode and ignore errors
+bool StarFilterHW::GetBinaryLog()
+{
+    return this->binary_log;
+}
 
-    shared_ptr<FILE> pipe(popen(ghdl_cmd.c_str(), "r"), pclose);
+void StarFilterHW::SetRawInput(bool en)
+{
+    this->raw_input = en;
+}
+
+bool StarFilterHW::GetRawInput()
+{
+    return this->raw_input;
+}
+
+void StarFilterHW::SetScratchDir(const string &dir)
+{
+    this->StopServer();
+
+    this->RemoveScratchDir();
 
-    if (!pipe)
+    this->scratch_dir = dir;
+}
+
+string StarFilterHW::GetScratchDir()
+{
+    if (this->scratch_dir.empty())
     {
-        string error_text = "popen() failed in ";
-        error_text += __func__;
-        error_text += " method from ";
-        error_text += __FILE__;
-        error_text += " file!";
+        char dir_template[] = STAR_FILTER_HW_SCRATCH_DIR_TEMPLATE;
+
+        if (!mkdtemp(dir_template))
+        {
+            throw runtime_error("mkdtemp() failed in " + string(__func__) + " method from " + __FILE__ + " file!");
+        }
+
+        this->scratch_dir       = dir_template;
+        this->scratch_dir_owned = true;
+    }
+
+    return this->scratch_dir;
+}
 
-        throw runtime_error(error_text.c_str());
+void StarFilterHW::SetNumberOfThreads(unsigned int n)
+{
+    this->pool.SetNumberOfThreads(n);
+}
+
+unsigned int StarFilterHW::GetNumberOfThreads()
+{
+    return this->pool.GetNumberOfThreads();
+}
+
+void StarFilterHW::RemoveScratchDir()
+{
+    this->Clear();
+
+    if (this->scratch_dir_owned)
+    {
+        rmdir(this->scratch_dir.c_str());
     }
+
+    this->scratch_dir.clear();
+    this->scratch_dir_owned = false;
 }
 
-vector<StarPixel> StarFilterHW::ReadStarPixelsFromFile(const char *file)
+void StarFilterHW::RunSimulation(const Mat &img)
 {
-    CSV<unsigned int> star_pixels_csv(file);
+    string dir = this->GetScratchDir();
+
+    // The arguments are passed without a shell (the Makefile quotes the file names)
+    vector<string> ghdl_cmd;
+
+    ghdl_cmd.push_back("make");
+    ghdl_cmd.push_back("STOP_TIME=" STAR_FILTER_HW_SIM_MAX_TIME_US "us");
+    if (this->raw_input)
+    {
+        ghdl_cmd.push_back("THRESHOLD=" + to_string(ScaleThreshold(this->GetThreshold(), img)));
+
+        this->WriteRawImage(img, dir + "/" STAR_FILTER_HW_BUFFER_IMG_RAW);
 
+        ghdl_cmd.push_back(MakeVariable("IMAGE_FILE", dir + "/" STAR_FILTER_HW_BUFFER_IMG_RAW));
+        ghdl_cmd.push_back("RAW_INPUT=TRUE");
+        ghdl_cmd.push_back("IMG_WIDTH=" + to_string(img.cols));
+        ghdl_cmd.push_back("IMG_HEIGHT=" + to_string(img.rows));
+        ghdl_cmd.push_back("PIXEL_BITS=" + to_string(img.elemSize1()*8));
+    }
+    else
+    {
+        // The sensor reads one byte per pixel from Netpbm files
+        if (img.depth() != CV_8U)
+        {
+            throw invalid_argument("Only 8-bit images are supported without the raw input in " + string(__func__) + " method from " + __FILE__ + " file!");
+        }
+
+        ghdl_cmd.push_back("THRESHOLD=" + to_string(this->GetThreshold()));
+
+        imwrite(dir + "/" STAR_FILTER_HW_BUFFER_IMG, img, vector<int>(IMWRITE_PXM_BINARY));
+
+        ghdl_cmd.push_back(MakeVariable("IMAGE_FILE", dir + "/" STAR_FILTER_HW_BUFFER_IMG));
+    }
+
+    string log_file = dir + "/" + (this->binary_log ? STAR_FILTER_HW_BUFFER_STAR_PIXELS_BIN : STAR_FILTER_HW_BUFFER_STAR_PIXELS);
+
+    ghdl_cmd.push_back(MakeVariable("LOG_FILE", log_file));
+
+    if (this->binary_log)
+    {
+        ghdl_cmd.push_back("LOG_BINARY=TRUE");
+    }
+
+    ghdl_cmd.push_back("-C");
+    ghdl_cmd.push_back(STAR_FILTER_HW_VHDL_FILES_DIR);
+
+    ghdl_cmd.push_back("-s");       // Silent mode
+
+    int exit_code = Subprocess::Run(ghdl_cmd);
+
+    // The simulation always stops with a failed assertion at the end of the image, so its exit code is not zero even
+    // when it succeeds. The log file is created at the start of the simulation, so a missing log is a failed run.
+    if ((exit_code < 0) or (access(log_file.c_str(), F_OK) != 0))
+    {
+        throw runtime_error("The GHDL simulation failed (exit code " + to_string(exit_code) + ") in " + string(__func__) + " method from " + __FILE__ + " file!");
+    }
+}
+
+unsigned int StarFilterHW::ScaleThreshold(uint8_t thr, const Mat &img)
+{
+    return (unsigned int)thr << (img.elemSize1()*8 - 8);
+}
+
+void StarFilterHW::WriteRawImage(const Mat &img, const string &file)
+{
+    if ((img.depth() != CV_8U) and (img.depth() != CV_16U))
+    {
+        throw invalid_argument("Only 8-bit and 16-bit images are supported in " + string(__func__) + " method from " + __FILE__ + " file!");
+    }
+
+    FILE *out_file = fopen(file.c_str(), "wb");
+
+    if (!out_file)
+    {
+        throw runtime_error("Impossible to create the raw image file in " + string(__func__) + " method from " + __FILE__ + " file!");
+    }
+
+    // The deleter of a shared_ptr is also called with a null pointer, so the file is only wrapped after the check
+    shared_ptr<FILE> out(out_file, fclose);
+
+    size_t row_len = img.cols*img.elemSize1();
+    bool ok = true;
+
+    if (img.channels() == 1)
+    {
+        // The pixels are written directly from the image buffer
+        if (img.isContinuous())
+        {
+            ok = fwrite(img.ptr<uchar>(0), 1, row_len*img.rows, out.get()) == row_len*img.rows;
+        }
+        else
+        {
+            for(int j=0; ok and (j<img.rows); j++)
+            {
+                ok = fwrite(img.ptr<uchar>(j), 1, row_len, out.get()) == row_len;
+            }
+        }
+    }
+    else
+    {
+        // Color images are filtered using the green channel
+        vector<uchar> row(row_len);
+
+        size_t px_size = img.elemSize1();
+        size_t step = img.elemSize();
+
+        for(int j=0; ok and (j<img.rows); j++)
+        {
+            const uchar *line = img.ptr<uchar>(j) + px_size;
+
+            for(int i=0; i<img.cols; i++)
+            {
+                for(size_t b=0; b<px_size; b++)
+                {
+                    row[i*px_size + b] = line[i*step + b];
+                }
+            }
+
+            ok = fwrite(row.data(), 1, row_len, out.get()) == row_len;
+        }
+    }
+
+    if (!ok)
+    {
+        throw runtime_error("Error writing the raw image file in " + string(__func__) + " method from " + __FILE__ + " file!");
+    }
+}
+
+string StarFilterHW::MakeVariable(const string &name, const string &value)
+{
+    string arg = name + "=";
+
+    for(unsigned int i=0; i<value.size(); i++)
+    {
+        if (value[i] == '$')
+        {
+            arg += '$';
+        }
+
+        arg += value[i];
+    }
+
+    return arg;
+}
+
+vector<StarPixel> StarFilterHW::ReadStarPixelsFromFile(const string &file)
+{
     vector<StarPixel> star_pixels;
- 
-    for(unsigned int i=0; i<star_pixels_csv.GetRows(); i++)
+
+    this->ReadStarPixelsFromFile(file, [&star_pixels](const StarPixel &star_pixel)
+        {
+            star_pixels.push_back(star_pixel);
+        });
+
+    return star_pixels;
+}
+
+void StarFilterHW::ReadStarPixelsFromFile(const string &file, const function<void(const StarPixel&)> &visitor)
+{
+    // Only the parse buffer of the cursor is constant, the memory of the star pixels is up to the visitor
+    CSVRowCursor<unsigned int, 3> star_pixels_csv(file.c_str());
+
+    while(star_pixels_csv.Next())
+    {
+        visitor(StarPixel(star_pixels_csv[STAR_FILTER_STAR_PIXELS_ROW_VAL],
+                          star_pixels_csv[STAR_FILTER_STAR_PIXELS_ROW_X],
+                          star_pixels_csv[STAR_FILTER_STAR_PIXELS_ROW_Y]));
+    }
+}
+
+void StarFilterHW::StartServer()
+{
+    if (this->server.IsRunning())
+    {
+        return;
+    }
+
+    // Cleans up a server that stopped
+    this->StopServer();
+
+    string cmd_fifo = this->GetScratchDir() + "/" STAR_FILTER_HW_SERVER_CMD_FIFO;
+    string resp_fifo = this->GetScratchDir() + "/" STAR_FILTER_HW_SERVER_RESP_FIFO;
+
+    // Removes the FIFOs of a previous server
+    unlink(cmd_fifo.c_str());
+    unlink(resp_fifo.c_str());
+
+    if ((mkfifo(cmd_fifo.c_str(), 0600) != 0) or (mkfifo(resp_fifo.c_str(), 0600) != 0))
+    {
+        this->StopServer();
+
+        throw runtime_error("mkfifo() failed in " + string(__func__) + " method from " + __FILE__ + " file!");
+    }
+
+    vector<string> ghdl_cmd;
+
+    ghdl_cmd.push_back("make");
+    ghdl_cmd.push_back("server");
+    ghdl_cmd.push_back(MakeVariable("CMD_FIFO", cmd_fifo));
+    ghdl_cmd.push_back(MakeVariable("RESP_FIFO", resp_fifo));
+    ghdl_cmd.push_back("-C");
+    ghdl_cmd.push_back(STAR_FILTER_HW_VHDL_FILES_DIR);
+    ghdl_cmd.push_back("-s");
+
+    this->server.Start(ghdl_cmd, true);
+
+    // The FIFO can only be opened after the simulation opens its other end (after the analysis and elaboration)
+    for(unsigned int t=0; t<STAR_FILTER_HW_SERVER_TIMEOUT_MS; t+=10)
+    {
+        this->server_cmd_fd = open(cmd_fifo.c_str(), O_WRONLY | O_NONBLOCK | O_CLOEXEC);
+
+        if ((this->server_cmd_fd >= 0) or (errno != ENXIO) or !this->server.IsRunning())
+        {
+            break;
+        }
+
+        this_thread::sleep_for(chrono::milliseconds(10));
+    }
+
+    if (this->server_cmd_fd < 0)
     {
-        star_pixels.push_back(StarPixel(star_pixels_csv.ReadCell(STAR_FILTER_STAR_PIXELS_ROW_VAL, i),
-                                        star_pixels_csv.ReadCell(STAR_FILTER_STAR_PIXELS_ROW_X, i),
-                                        star_pixels_csv.ReadCell(STAR_FILTER_STAR_PIXELS_ROW_Y, i)));
+        this->StopServer();
+
+        throw runtime_error("The simulation server did not start in " + string(__func__) + " method from " + __FILE__ + " file!");
+    }
+
+    // The FIFO is kept in non-blocking mode, so a write never waits for a simulation that stopped reading
+}
+
+void StarFilterHW::StopServer()
+{
+    if (this->server_cmd_fd >= 0)
+    {
+        char cmd = STAR_FILTER_HW_SERVER_CMD_QUIT;
+
+        if (WriteNoSignal(this->server_cmd_fd, &cmd, 1) != 1)
+        {
+            // The simulation is already finished (or is not reading its FIFO)
+        }
+
+        close(this->server_cmd_fd);
+
+        this->server_cmd_fd = -1;
+    }
+
+    // A simulation that does not quit (as one that stopped responding) is killed
+    for(unsigned int t=0; (t<STAR_FILTER_HW_SERVER_STOP_TIMEOUT_MS) and this->server.IsRunning(); t+=10)
+    {
+        this_thread::sleep_for(chrono::milliseconds(10));
+    }
+
+    this->server.Kill();
+
+    if (!this->scratch_dir.empty())
+    {
+        unlink((this->scratch_dir + "/" STAR_FILTER_HW_SERVER_CMD_FIFO).c_str());
+        unlink((this->scratch_dir + "/" STAR_FILTER_HW_SERVER_RESP_FIFO).c_str());
+    }
+}
+
+vector<StarPixel> StarFilterHW::RunServerFrame(const Mat &img)
+{
+    if ((img.cols > STAR_FILTER_HW_SERVER_MAX_IMG_SIZE) or (img.rows > STAR_FILTER_HW_SERVER_MAX_IMG_SIZE))
+    {
+        throw runtime_error("Image too large for the simulation server in " + string(__func__) + " method from " + __FILE__ + " file!");
+    }
+
+    this->StartServer();
+
+    // Frame header (command, threshold, width and height as little-endian 16-bit values)
+    vector<uint8_t> frame(6);
+
+    frame[0] = STAR_FILTER_HW_SERVER_CMD_FRAME;
+    frame[1] = this->GetThreshold();
+    frame[2] = img.cols & 0xFF;
+    frame[3] = (img.cols >> 8) & 0xFF;
+    frame[4] = img.rows & 0xFF;
+    frame[5] = (img.rows >> 8) & 0xFF;
+
+    frame.reserve(frame.size() + img.cols*img.rows);
+
+    // Color images are filtered using the green channel
+    unsigned int step = (img.channels() > 1) ? 3 : 1;
+    unsigned int offset = (img.channels() > 1) ? 1 : 0;
+
+    for(int j=0; j<img.rows; j++)
+    {
+        const uint8_t *line = img.ptr<uchar>(j) + offset;
+
+        for(int i=0; i<img.cols; i++)
+        {
+            frame.push_back(line[i*step]);
+        }
+    }
+
+    // The frame is written while the star pixels are read, as the simulation consumes the pixels as it runs
+    int fd = this->server_cmd_fd;
+    atomic<bool> sent(false);
+    atomic<bool> cancel(false);
+    atomic<long long> last_progress(NowMs());
+
+    thread writer([&frame, &sent, &cancel, &last_progress, fd]()
+        {
+            size_t pos = 0;
+
+            while((pos < frame.size()) and !cancel)
+            {
+                struct pollfd pfd = {fd, POLLOUT, 0};
+
+                // The timeout is checked by the reader
+                if (poll(&pfd, 1, STAR_FILTER_HW_SERVER_POLL_MS) <= 0)
+                {
+                    continue;
+                }
+
+                ssize_t n = WriteNoSignal(fd, frame.data() + pos, frame.size() - pos);
+
+                if (n < 0)
+                {
+                    if ((errno == EINTR) or (errno == EAGAIN))
+                    {
+                        continue;
+                    }
+
+                    break;
+                }
+
+                pos += n;
+
+                last_progress = NowMs();
+            }
+
+            sent = (pos == frame.size());
+        });
+
+    vector<StarPixel> star_pixels;
+    bool received = false;
+
+    // The FIFO is opened in non-blocking mode, so the open and the reads cannot wait forever for the simulation
+    int resp = open((this->scratch_dir + "/" STAR_FILTER_HW_SERVER_RESP_FIFO).c_str(), O_RDONLY | O_NONBLOCK | O_CLOEXEC);
+
+    if (resp >= 0)
+    {
+        vector<char> buffer(STAR_FILTER_HW_SERVER_READ_SIZE);
+        string line;
+
+        while(true)
+        {
+            struct pollfd pfd = {resp, POLLIN, 0};
+
+            int res = poll(&pfd, 1, STAR_FILTER_HW_SERVER_POLL_MS);
+
+            if (res > 0)
+            {
+                ssize_t n = read(resp, buffer.data(), buffer.size());
+
+                if (n == 0)
+                {
+                    // The simulation closed the FIFO (end of the frame)
+                    received = true;
+
+                    break;
+                }
+
+                if (n < 0)
+                {
+                    if ((errno == EINTR) or (errno == EAGAIN))
+                    {
+                        continue;
+                    }
+
+                    break;
+                }
+
+                last_progress = NowMs();
+
+                for(ssize_t i=0; i<n; i++)
+                {
+                    if (buffer[i] == '\n')
+                    {
+                        ParseServerLine(line, star_pixels);
+
+                        line.clear();
+                    }
+                    else
+                    {
+                        line += buffer[i];
+                    }
+                }
+            }
+            else if ((res < 0) and (errno != EINTR))
+            {
+                break;
+            }
+            else if (!this->server.IsRunning() or (NowMs() - last_progress > STAR_FILTER_HW_SERVER_TIMEOUT_MS))
+            {
+                break;
+            }
+        }
+
+        ParseServerLine(line, star_pixels);
+
+        close(resp);
+    }
+
+    cancel = true;
+
+    writer.join();
+
+    if (!received or !sent)
+    {
+        this->StopServer();
+
+        throw runtime_error("The simulation server stopped or did not respond in " + string(__func__) + " method from " + __FILE__ + " file!");
     }
 
     return star_pixels;
@@ -0,0 +1,420 @@
+/*
+ * star_filter_rtl.cpp
+ * 
+ * Copyright (C) 2020, Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ * 
+ * This file is part of CEST library.
+ * 
+ * CEST library is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * CEST library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with CEST library. If not, see <http://www.gnu.org/licenses/>.
+ * 
+ */
+
+/**
+ * \brief Star filter (cycle-accurate model of the hardware) implementation.
+ * 
+ * \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ * 
+ * \version 0.1.0
+ * 
+ * \date 18/10/2026
+ * 
+ * \addtogroup star-filter-rtl
+ * \{
+ */
+
+#include <string>
+#include <stdexcept>
+
+#include <cest/star_filter_rtl.h>
+
+using namespace std;
+using namespace cv;
+using namespace cest;
+
+StarFilterRTL::StarFilterRTL()
+    : StarFilter()
+{
+    this->log = NULL;
+    this->time = 0;
+    this->raw_input = STAR_FILTER_RTL_DEFAULT_RAW_INPUT;
+
+    this->SetImageSize(STAR_FILTER_RTL_IMG_WIDTH, STAR_FILTER_RTL_IMG_HEIGHT);
+    this->SetStopTime(STAR_FILTER_RTL_SIM_MAX_TIME_US);
+}
+
+StarFilterRTL::StarFilterRTL(uint8_t thr)
+    : StarFilterRTL()
+{
+    this->SetThreshold(thr);
+}
+
+StarFilterRTL::~StarFilterRTL()
+{
+
+}
+
+vector<StarPixel> StarFilterRTL::GetStarPixels(const Mat &img)
+{
+    if (img.depth() != CV_8U)
+    {
+        throw invalid_argument("Only 8-bit images are supported in " + string(__func__) + " method from " + __FILE__ + " file!");
+    }
+
+    // The same input file of the hardware simulation
+    vector<uchar> file;
+
+    if (this->raw_input)
+    {
+        this->SetImageSize(img.cols, img.rows);
+
+        // Color images are filtered using the green channel
+        unsigned int step = (img.channels() > 1) ? img.channels() : 1;
+        unsigned int offset = (img.channels() > 1) ? 1 : 0;
+
+        file.reserve(img.cols*img.rows);
+
+        for(int j=0; j<img.rows; j++)
+        {
+            const uchar *line = img.ptr<uchar>(j) + offset;
+
+            for(int i=0; i<img.cols; i++)
+            {
+                file.push_back(line[i*step]);
+            }
+        }
+    }
+    else
+    {
+        imencode(".pgm", img, file, vector<int>{IMWRITE_PXM_BINARY, 1});
+    }
+
+    vector<StarPixel> star_pixels;
+
+    this->Run(file.data(), file.size(), star_pixels);
+
+    return star_pixels;
+}
+
+vector<StarPixel> StarFilterRTL::GetStarPixels(const Mat &img, uint8_t thr)
+{
+    this->SetThreshold(thr);
+
+    return this->GetStarPixels(img);
+}
+
+void StarFilterRTL::Run(const uint8_t *file, size_t len, vector<StarPixel> &star_pixels)
+{
+    if (len == 0)
+    {
+        throw runtime_error("Empty sensor input file in " + string(__func__) + " method from " + __FILE__ + " file!");
+    }
+
+    star_pixels.clear();
+
+    // Initial values of the signals
+    this->sensor.pixclk         = -1;
+    this->sensor.hsync          = -1;
+    this->sensor.vsync          = -1;
+    this->sensor.data           = 0;
+    this->sensor.header_ready   = this->raw_input;     // There is no header in the raw input
+    this->sensor.byte_dump      = false;
+    this->sensor.header_line    = 0;
+    this->sensor.header_col     = 0;
+    this->sensor.column_counter = 0;
+    this->sensor.line_counter   = 0;
+
+    this->sensor_next = this->sensor;
+
+    this->gray_pixel    = 0;
+    this->gray_clk      = -1;
+    this->star_px_val   = 0;
+    this->thresh_clk    = 0;
+    this->i_pos         = this->width - 1;
+    this->j_pos         = 0;
+
+    this->time  = 0;
+    this->log   = &star_pixels;
+
+    // Sensor process (it restarts from the beginning of the file when its end is reached)
+    bool running = true;
+
+    while(running)
+    {
+        this->sensor_next.data  = 0;
+        this->sensor_next.vsync = 0;
+        this->sensor_next.hsync = 0;
+
+        for(size_t pos=0; running and (pos<len); pos++)
+        {
+            running = this->Wait();     // Rising edge
+
+            if (!running)
+            {
+                break;
+            }
+
+            this->sensor_next.pixclk = 1;
+
+            if (!this->sensor.header_ready)
+            {
+                this->ParseHeader(file[pos]);
+
+                running = this->Wait(); // Falling edge
+
+                this->sensor_next.pixclk = 0;
+            }
+            else
+            {
+                this->sensor_next.vsync = 1;
+                this->sensor_next.hsync = 1;
+                this->sensor_next.data  = file[pos];
+
+                running = this->Wait(); // Falling edge
+
+                this->sensor_next.pixclk = 0;
+
+                if (running and (this->sensor.column_counter == this->width-1))
+                {
+                    this->sensor_next.hsync             = 0;
+                    this->sensor_next.column_counter    = 0;
+                    this->sensor_next.line_counter      = this->sensor.line_counter + 1;
+
+                    // Blank region
+                    for(unsigned int i=0; running and (i<STAR_FILTER_RTL_BLANK_REGION_CLKS); i++)
+                    {
+                        running = this->Wait();
+
+                        this->sensor_next.pixclk = 1;
+
+                        running = running and this->Wait();
+
+                        this->sensor_next.pixclk = 0;
+                    }
+                }
+                else
+                {
+                    this->sensor_next.column_counter = this->sensor.column_counter + 1;
+                }
+
+                // End of image reached (the simulation is stopped before updating the signals)
+                if (running and (this->sensor.line_counter == this->height-1))
+                {
+                    running = false;
+                }
+            }
+        }
+    }
+
+    this->log = NULL;
+}
+
+void StarFilterRTL::SetImageSize(unsigned int w, unsigned int h)
+{
+    if ((w < 2) or (h < 2))
+    {
+        throw invalid_argument("Invalid image size in " + string(__func__) + " method from " + __FILE__ + " file!");
+    }
+
+    this->width     = w;
+    this->height    = h;
+}
+
+void StarFilterRTL::SetRawInput(bool en)
+{
+    this->raw_input = en;
+}
+
+bool StarFilterRTL::GetRawInput()
+{
+    return this->raw_input;
+}
+
+void StarFilterRTL::SetStopTime(uint64_t us)
+{
+    this->stop_time = us*1000;
+}
+
+uint64_t StarFilterRTL::GetNumberOfCycles()
+{
+    return this->time/(2*STAR_FILTER_RTL_CLK_HALF_PERIOD_NS);
+}
+
+bool StarFilterRTL::Wait()
+{
+    SensorSignals prev = this->sensor;
+
+    this->sensor = this->sensor_next;
+
+    bool hsync_falling_edge = (prev.hsync == 1) and (this->sensor.hsync == 0);
+
+    if ((prev.pixclk == 0) and (this->sensor.pixclk == 1))
+    {
+        this->PixelClockRisingEdge();
+    }
+
+    if ((prev.pixclk == 1) and (this->sensor.pixclk == 0))
+    {
+        this->PixelClockFallingEdge();
+    }
+
+    if (hsync_falling_edge)
+    {
+        this->HSyncFallingEdge();
+    }
+
+    this->time += STAR_FILTER_RTL_CLK_HALF_PERIOD_NS;
+
+    return this->time <= this->stop_time;
+}
+
+void StarFilterRTL::PixelClockRisingEdge()
+{
+    // Grayscale: the pixel clock goes low, which is the sampling edge of the Threshold block
+    if (this->gray_clk == 1)
+    {
+        this->gray_clk = 0;
+
+        if (this->gray_pixel > this->threshold)
+        {
+            this->star_px_val   = this->gray_pixel;
+            this->thresh_clk    = 1;
+        }
+        else
+        {
+            this->star_px_val = 0;
+        }
+    }
+}
+
+void StarFilterRTL::PixelClockFallingEdge()
+{
+    // Grayscale (one channel)
+    this->gray_pixel    = this->sensor.data;
+    this->gray_clk      = 1;
+
+    // Threshold: the falling edge of its pixel clock is the log enable, and the counters are seen before this edge
+    if (this->thresh_clk == 1)
+    {
+        this->thresh_clk = 0;
+
+        unsigned int x_mask = (1U << this->CounterBits(this->width-1)) - 1;
+        unsigned int y_mask = (1U << this->CounterBits(this->height)) - 1;
+
+        this->log->push_back(StarPixel(this->star_px_val, this->i_pos & x_mask, this->j_pos & y_mask));
+    }
+
+    // X-axis counter (reset and enable are the horizontal sync)
+    if (this->sensor.hsync == 0)
+    {
+        this->i_pos = this->width - 1;
+    }
+    else if (this->sensor.hsync == 1)
+    {
+        this->i_pos = (this->i_pos != this->width-1) ? this->i_pos + 1 : 0;
+    }
+}
+
+void StarFilterRTL::HSyncFallingEdge()
+{
+    // Y-axis counter (reset and enable are the vertical sync)
+    if (this->sensor.vsync == 0)
+    {
+        this->j_pos = 0;
+    }
+    else if (this->sensor.vsync == 1)
+    {
+        this->j_pos = (this->j_pos != this->height) ? this->j_pos + 1 : 0;
+    }
+}
+
+void StarFilterRTL::ParseHeader(uint8_t byte)
+{
+    this->sensor_next.hsync = 0;
+
+    if (this->sensor.byte_dump)
+    {
+        if (byte == 10)                                         // '\n'
+        {
+            this->sensor_next.byte_dump = false;
+        }
+    }
+    else if ((this->sensor.header_col == 0) and (byte == 35))   // Ignores a line with comment ('#')
+    {
+        this->sensor_next.byte_dump = true;
+    }
+    else if (this->sensor.header_line == 0)
+    {
+        if (this->sensor.header_col == 0)
+        {
+            if (byte == 80)                                     // 'P'
+            {
+                this->sensor_next.header_col = this->sensor.header_col + 1;
+            }
+        }
+        else if (this->sensor.header_col == 1)
+        {
+            if ((byte >= 49) and (byte <= 54))                  // '1' to '6'
+            {
+                this->sensor_next.header_col = this->sensor.header_col + 1;
+            }
+        }
+        else if (byte == 10)
+        {
+            this->sensor_next.header_line = this->sensor.header_line + 1;
+        }
+
+        if (byte == 10)
+        {
+            this->sensor_next.header_col    = 0;
+            this->sensor_next.header_line   = this->sensor.header_line + 1;
+        }
+    }
+    else if (this->sensor.header_line == 1)
+    {
+        if (byte == 32)                                         // ' '
+        {
+            this->sensor_next.header_col = this->sensor.header_col + 1;
+        }
+        else if ((byte == 10) or (this->sensor.header_col > 1))
+        {
+            this->sensor_next.header_col    = 0;
+            this->sensor_next.header_line   = this->sensor.header_line + 1;
+        }
+    }
+    else if (this->sensor.header_line == 2)
+    {
+        if (byte == 10)
+        {
+            this->sensor_next.header_ready = true;
+        }
+        else
+        {
+            this->sensor_next.header_col = this->sensor.header_col + 1;
+        }
+    }
+}
+
+unsigned int StarFilterRTL::CounterBits(unsigned int upper_limit)
+{
+    unsigned int bits = 0;
+
+    while((bits < 31) and ((1U << bits) <= upper_limit))
+    {
+        bits++;
+    }
+
+    return bits;
+}
+
+//! \} End of star-filter-rtl group
@@ -33,55 +33,103 @@
  * \{
  */
 
+#include <algorithm>
+
 #include <cest/star_filter_sw.h>
 
 using namespace std;
 using namespace cv;
 using namespace cest;
 
+static inline void AppendStarPixel(vector<StarPixel> &star_pixels, const uint8_t *line, unsigned int step, unsigned int x, unsigned int y)
+{
+    star_pixels.push_back(StarPixel(line[x*step], x, y));
+}
+
+static inline void AppendStarPixel(StarPixelBuffer &star_pixels, const uint8_t *line, unsigned int step, unsigned int x, unsigned int y)
+{
+    star_pixels.Append(line[x*step], x, y);
+}
+
+static inline void AppendStarPixel(vector<StarPixelSpan> &spans, const uint8_t *line, unsigned int step, unsigned int x, unsigned int y)
+{
+    if (!spans.empty() and (spans.back().row == y) and (spans.back().x_end+1 == x))
+    {
+        spans.back().x_end = x;
+    }
+    else
+    {
+        spans.push_back(StarPixelSpan(y, x, x, line + x*step, step));
+    }
+}
+
+template<class T>
+static inline void AppendStarPixels(vector<T> &star_pixels, const vector<T> &src)
+{
+    star_pixels.insert(star_pixels.end(), src.begin(), src.end());
+}
+
+static inline void AppendStarPixels(StarPixelBuffer &star_pixels, const StarPixelBuffer &src)
+{
+    star_pixels.Append(src);
+}
+
+template<class T>
+static inline void ClearStarPixels(vector<T> &star_pixels)
+{
+    star_pixels.clear();
+}
+
+static inline void ClearStarPixels(StarPixelBuffer &star_pixels)
+{
+    star_pixels.Clear();
+}
+
 StarFilterSW::StarFilterSW()
-    : StarFilter()
+    : StarFilter(), pool(STAR_FILTER_SW_DEFAULT_THREADS)
 {
 
 }
 
 StarFilterSW::StarFilterSW(uint8_t thr)
-    : StarFilter()
+    : StarFilter(), pool(STAR_FILTER_SW_DEFAULT_THREADS)
 {
     this->SetThreshold(thr);
 }
 
-vector<StarPixel> StarFilterSW::GetStarPixels(Mat img)
+vector<StarPixel> StarFilterSW::GetStarPixels(const Mat &img)
 {
     vector<StarPixel> star_pixels;
 
-    for(unsigned int i=0; i<img.rows; i++)
-    {
-        for(unsigned int j=0; j<img.cols; j++)
-        {
-            uint8_t pix_color;
-
-            if (img.channels() > 1)
-            {
-                pix_color = img.at<Vec3b>(i,j)[1];  // Green channel
-            }
-            else
-            {
-                pix_color = img.at<uchar>(i,j);
-            }
-
-            // Pixel threshold
-            if (pix_color > this->GetThreshold())
-            {
-                star_pixels.push_back(StarPixel(pix_color, j, i));
-            }
-        }
-    }
+    this->GetStarPixels(img, star_pixels);
 
     return star_pixels;
 }
 
-vector<StarPixel> StarFilterSW::GetStarPixels(Mat img, uint8_t thr)
+void StarFilterSW::GetStarPixels(const Mat &img, vector<StarPixel> &star_pixels)
+{
+    star_pixels.clear();
+
+    this->Filter(img, star_pixels, this->band_pixels);
+}
+
+void StarFilterSW::GetStarPixels(const Mat &img, StarPixelBuffer &star_pixels)
+{
+    this->CheckBufferImageSize(img);
+
+    star_pixels.Clear();
+
+    this->Filter(img, star_pixels, this->band_buffers);
+}
+
+void StarFilterSW::GetStarSpans(const Mat &img, vector<StarPixelSpan> &spans)
+{
+    spans.clear();
+
+    this->Filter(img, spans, this->band_spans);
+}
+
+vector<StarPixel> StarFilterSW::GetStarPixels(const Mat &img, uint8_t thr)
 {
     this->SetThreshold(thr);
 
@@ -93,4 +141,78 @@ void StarFilterSW::SetThreshold(uint8_t val)
     this->threshold = val;
 }
 
+void StarFilterSW::SetNumberOfThreads(unsigned int n)
+{
+    this->pool.SetNumberOfThreads(n);
+}
+
+unsigned int StarFilterSW::GetNumberOfThreads()
+{
+    return this->pool.GetNumberOfThreads();
+}
+
+template<class TStarPixels>
+void StarFilterSW::Filter(const Mat &img, TStarPixels &star_pixels, vector<TStarPixels> &bands)
+{
+    unsigned int threads = this->GetNumberOfThreads();
+
+    if ((threads == 1) or (img.rows < 2))
+    {
+        this->FilterRows(img, 0, img.rows, this->columns, star_pixels);
+
+        return;
+    }
+
+    unsigned int n_bands = min(threads*STAR_FILTER_SW_BANDS_PER_THREAD, (unsigned int)img.rows);
+
+    bands.resize(n_bands);
+    this->band_columns.resize(n_bands);
+
+    // The task captures only two pointers, so the std::function does not allocate memory
+    struct
+    {
+        const Mat *img;
+        vector<TStarPixels> *bands;
+        unsigned int n_bands;
+    } job = {&img, &bands, n_bands};
+
+    this->pool.Run(n_bands, [this, &job](unsigned int b)
+    {
+        vector<TStarPixels> &band = *job.bands;
+        int rows = job.img->rows;
+
+        ClearStarPixels(band[b]);
+
+        this->FilterRows(*job.img, (b*rows)/job.n_bands, ((b+1)*rows)/job.n_bands, this->band_columns[b], band[b]);
+    });
+
+    // Merges the bands in raster order
+    for(unsigned int b=0; b<n_bands; b++)
+    {
+        AppendStarPixels(star_pixels, bands[b]);
+    }
+}
+
+template<class TStarPixels>
+void StarFilterSW::FilterRows(const Mat &img, int first, int last, vector<unsigned int> &cols, TStarPixels &star_pixels)
+{
+    cols.resize(img.cols);
+
+    // Color images are filtered using the green channel
+    unsigned int step = (img.channels() > 1) ? 3 : 1;
+    unsigned int offset = (img.channels() > 1) ? 1 : 0;
+
+    for(int i=first; i<last; i++)
+    {
+        const uint8_t *line = img.ptr<uchar>(i) + offset;
+
+        unsigned int n = this->kernel.Run(line, img.cols, step, this->GetThreshold(), cols.data());
+
+        for(unsigned int k=0; k<n; k++)
+        {
+            AppendStarPixel(star_pixels, line, step, cols[k], i);
+        }
+    }
+}
+
 //! \} End of star-filter-sw group
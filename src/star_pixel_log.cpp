@@ -0,0 +1,151 @@
+/*
+ * star_pixel_log.cpp
+ * 
+ * Copyright (C) 2020, Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ * 
+ * This file is part of CEST library.
+ * 
+ * CEST library is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * CEST library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with CEST library. If not, see <http://www.gnu.org/licenses/>.
+ * 
+ */
+
+/**
+ * \brief Binary star pixel log reader implementation.
+ * 
+ * \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ * 
+ * \version 0.1.0
+ * 
+ * \date 18/10/2026
+ * 
+ * \addtogroup star-pixel-log
+ * \{
+ */
+
+#include <stdexcept>
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include <cest/star_pixel_log.h>
+
+using namespace std;
+using namespace cest;
+
+StarPixelLog::StarPixelLog()
+{
+    this->map       = NULL;
+    this->map_len   = 0;
+    this->records   = 0;
+}
+
+StarPixelLog::StarPixelLog(const string &file)
+{
+    this->map       = NULL;
+    this->map_len   = 0;
+    this->records   = 0;
+
+    this->Open(file);
+}
+
+StarPixelLog::~StarPixelLog()
+{
+    this->Close();
+}
+
+void StarPixelLog::Open(const string &file)
+{
+    this->Close();
+
+    int fd = open(file.c_str(), O_RDONLY | O_CLOEXEC);
+
+    if (fd < 0)
+    {
+        throw runtime_error("Impossible to open the log file " + file + " in " + string(__func__) + " method from " + __FILE__ + " file!");
+    }
+
+    struct stat st;
+
+    if (fstat(fd, &st) != 0)
+    {
+        close(fd);
+
+        throw runtime_error("fstat() failed in " + string(__func__) + " method from " + __FILE__ + " file!");
+    }
+
+    if (st.st_size > 0)
+    {
+        void *addr = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+        if (addr == MAP_FAILED)
+        {
+            close(fd);
+
+            throw runtime_error("mmap() failed in " + string(__func__) + " method from " + __FILE__ + " file!");
+        }
+
+        madvise(addr, st.st_size, MADV_SEQUENTIAL);
+
+        this->map       = addr;
+        this->map_len   = st.st_size;
+        this->records   = st.st_size/STAR_PIXEL_LOG_RECORD_SIZE;   // An incomplete record is ignored
+    }
+
+    close(fd);
+}
+
+void StarPixelLog::Close()
+{
+    if (this->map)
+    {
+        munmap(this->map, this->map_len);
+    }
+
+    this->map       = NULL;
+    this->map_len   = 0;
+    this->records   = 0;
+}
+
+size_t StarPixelLog::GetSize() const
+{
+    return this->records;
+}
+
+const StarPixelRecord* StarPixelLog::GetRecords() const
+{
+    return static_cast<const StarPixelRecord*>(this->map);
+}
+
+StarPixel StarPixelLog::operator[](size_t i) const
+{
+    const StarPixelRecord &rec = this->GetRecords()[i];
+
+    return StarPixel(rec.value, rec.x, rec.y);
+}
+
+void StarPixelLog::GetStarPixels(vector<StarPixel> &star_pixels) const
+{
+    const StarPixelRecord *recs = this->GetRecords();
+
+    star_pixels.reserve(star_pixels.size() + this->records);
+
+    for(size_t i=0; i<this->records; i++)
+    {
+        star_pixels.push_back(StarPixel(recs[i].value, recs[i].x, recs[i].y));
+    }
+}
+
+//! \} End of star-pixel-log group
@@ -0,0 +1,219 @@
+/*
+ * stream_labeler.cpp
+ * 
+ * Copyright (C) 2020, Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ * 
+ * This file is part of CEST library.
+ * 
+ * CEST library is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * CEST library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with CEST library. If not, see <http://www.gnu.org/licenses/>.
+ * 
+ */
+
+/**
+ * \brief Streaming blob labeler implementation.
+ * 
+ * \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ * 
+ * \version 0.1.0
+ * 
+ * \date 18/10/2026
+ * 
+ * \addtogroup stream-labeler
+ * \{
+ */
+
+#include <cest/stream_labeler.h>
+
+using namespace std;
+using namespace cest;
+
+StreamLabeler::StreamLabeler(unsigned int w, uint8_t thr)
+{
+    this->row = 0;
+
+    this->SetThreshold(thr);
+    this->SetWidth(w);
+}
+
+StreamLabeler::~StreamLabeler()
+{
+
+}
+
+void StreamLabeler::SetThreshold(uint8_t thr)
+{
+    this->threshold = thr;
+}
+
+void StreamLabeler::SetWidth(unsigned int w)
+{
+    this->width = w;
+
+    this->prev_labels.assign(w+1, 0);
+    this->cur_labels.assign(w+1, 0);
+    this->prev_xs.reserve(w);
+    this->cur_xs.reserve(w);
+
+    this->Reset();
+}
+
+unsigned int StreamLabeler::GetWidth()
+{
+    return this->width;
+}
+
+unsigned int StreamLabeler::GetNumberOfOpenBlobs()
+{
+    return this->open_blobs.size();
+}
+
+unsigned int StreamLabeler::PushRow(const uint8_t *pix, vector<Centroid> &centroids, unsigned int step)
+{
+    unsigned int y = this->row++;
+
+    // The current row becomes the previous one
+    for(unsigned int i=0; i<this->prev_xs.size(); i++)
+    {
+        this->prev_labels[this->prev_xs[i]] = 0;
+    }
+
+    this->prev_labels.swap(this->cur_labels);
+    this->prev_xs.swap(this->cur_xs);
+
+    // cur_xs is also used as the output buffer of the kernel
+    this->cur_xs.resize(this->width);
+    this->cur_xs.resize(this->kernel.Run(pix, this->width, step, this->threshold, this->cur_xs.data()));
+
+    for(unsigned int i=0; i<this->cur_xs.size(); i++)
+    {
+        unsigned int x = this->cur_xs[i];
+
+        unsigned int label = this->blobs.JoinNeighbours(x, this->cur_labels, this->prev_labels);
+
+        unsigned int b = (label == 0) ? this->NewBlob() : label-1;
+
+        this->blobs.Add(b, x, y, pix[x*step]);
+
+        this->cur_labels[x] = b + 1;
+    }
+
+    // The labels of the current row point to the roots, so the merged slots can be reused
+    for(unsigned int i=0; i<this->cur_xs.size(); i++)
+    {
+        unsigned int x = this->cur_xs[i];
+        unsigned int b = this->blobs.Find(this->cur_labels[x]-1);
+
+        this->cur_labels[x] = b + 1;
+        this->last_row[b]   = y;
+    }
+
+    // A blob without pixels in this row will not grow anymore
+    unsigned int emitted = 0;
+    unsigned int n_open = 0;
+
+    for(unsigned int i=0; i<this->open_blobs.size(); i++)
+    {
+        unsigned int b = this->open_blobs[i];
+
+        if (!this->blobs.IsRoot(b))
+        {
+            this->free_blobs.push_back(b);
+        }
+        else if (this->last_row[b] != y)
+        {
+            centroids.push_back(this->blobs.GetCentroid(b));
+            this->free_blobs.push_back(b);
+
+            emitted++;
+        }
+        else
+        {
+            this->open_blobs[n_open++] = b;
+        }
+    }
+
+    this->open_blobs.resize(n_open);
+
+    return emitted;
+}
+
+unsigned int StreamLabeler::EndFrame(vector<Centroid> &centroids)
+{
+    unsigned int emitted = 0;
+
+    for(unsigned int i=0; i<this->open_blobs.size(); i++)
+    {
+        unsigned int b = this->open_blobs[i];
+
+        if (this->blobs.IsRoot(b))
+        {
+            centroids.push_back(this->blobs.GetCentroid(b));
+
+            emitted++;
+        }
+    }
+
+    this->Reset();
+
+    return emitted;
+}
+
+void StreamLabeler::Reset()
+{
+    for(unsigned int i=0; i<this->prev_xs.size(); i++)
+    {
+        this->prev_labels[this->prev_xs[i]] = 0;
+    }
+
+    for(unsigned int i=0; i<this->cur_xs.size(); i++)
+    {
+        this->cur_labels[this->cur_xs[i]] = 0;
+    }
+
+    this->prev_xs.clear();
+    this->cur_xs.clear();
+
+    this->blobs.Clear();
+    this->last_row.clear();
+    this->open_blobs.clear();
+    this->free_blobs.clear();
+
+    this->row = 0;
+}
+
+unsigned int StreamLabeler::NewBlob()
+{
+    unsigned int b;
+
+    if (this->free_blobs.empty())
+    {
+        b = this->blobs.NewBlob();
+
+        this->last_row.push_back(0);
+    }
+    else
+    {
+        b = this->free_blobs.back();
+        this->free_blobs.pop_back();
+
+        this->blobs.ResetBlob(b);
+        this->last_row[b] = 0;
+    }
+
+    this->open_blobs.push_back(b);
+
+    return b;
+}
+
+//! \} End of stream-labeler group
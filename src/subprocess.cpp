@@ -0,0 +1,229 @@
+/*
+ * subprocess.cpp
+ * 
+ * Copyright (C) 2020, Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ * 
+ * This file is part of CEST library.
+ * 
+ * CEST library is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * CEST library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with CEST library. If not, see <http://www.gnu.org/licenses/>.
+ * 
+ */
+
+/**
+ * \brief Child process implementation.
+ * 
+ * \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ * 
+ * \version 0.1.0
+ * 
+ * \date 18/10/2026
+ * 
+ * \addtogroup subprocess
+ * \{
+ */
+
+#include <cerrno>
+#include <csignal>
+#include <stdexcept>
+
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/wait.h>
+#include <sys/syscall.h>
+
+#include <cest/subprocess.h>
+
+using namespace std;
+
+Subprocess::Subprocess()
+{
+    this->pid       = -1;
+    this->exit_code = 0;
+}
+
+Subprocess::~Subprocess()
+{
+    this->Kill();
+}
+
+void Subprocess::Start(const vector<string> &args, bool quiet)
+{
+    if (args.empty())
+    {
+        throw invalid_argument("No program to run in " + string(__func__) + " method from " + __FILE__ + " file!");
+    }
+
+    this->Kill();
+
+    // The arguments are prepared before the fork, as the child of a multithreaded process cannot allocate memory
+    vector<char*> argv;
+
+    for(unsigned int i=0; i<args.size(); i++)
+    {
+        argv.push_back(const_cast<char*>(args[i].c_str()));
+    }
+
+    argv.push_back(NULL);
+
+    long max_fd = sysconf(_SC_OPEN_MAX);
+
+    if (max_fd < 0)
+    {
+        max_fd = SUBPROCESS_DEFAULT_MAX_FD;
+    }
+
+    pid_t child = fork();
+
+    if (child < 0)
+    {
+        throw runtime_error("fork() failed in " + string(__func__) + " method from " + __FILE__ + " file!");
+    }
+
+    if (child == 0)
+    {
+        setpgid(0, 0);
+
+        int null_fd = open("/dev/null", O_RDWR);
+
+        if (null_fd >= 0)
+        {
+            dup2(null_fd, STDIN_FILENO);
+            dup2(null_fd, STDOUT_FILENO);
+
+            if (quiet)
+            {
+                dup2(null_fd, STDERR_FILENO);
+            }
+        }
+
+        // The descriptors of the parent (as the FIFOs of other StarFilterHW objects) are not inherited
+#ifdef SYS_close_range
+        if (syscall(SYS_close_range, STDERR_FILENO + 1, ~0U, 0) != 0)
+#endif // SYS_close_range
+        {
+            for(long fd=STDERR_FILENO+1; fd<max_fd; fd++)
+            {
+                close(fd);
+            }
+        }
+
+        execvp(argv[0], argv.data());
+
+        _exit(127);
+    }
+
+    // Also set by the parent, so the group exists before the Kill method can be called
+    setpgid(child, child);
+
+    this->pid = child;
+}
+
+int Subprocess::Wait()
+{
+    if (this->pid > 0)
+    {
+        int status;
+        pid_t res;
+
+        do
+        {
+            res = waitpid(this->pid, &status, 0);
+        }
+        while((res < 0) and (errno == EINTR));
+
+        if (res == this->pid)
+        {
+            this->SetExitStatus(status);
+        }
+        else
+        {
+            this->SetWaitError();
+        }
+    }
+
+    return this->exit_code;
+}
+
+bool Subprocess::IsRunning()
+{
+    if (this->pid <= 0)
+    {
+        return false;
+    }
+
+    int status;
+
+    pid_t res = waitpid(this->pid, &status, WNOHANG);
+
+    if (res == 0)
+    {
+        return true;
+    }
+
+    if (res == this->pid)
+    {
+        this->SetExitStatus(status);
+    }
+    else if ((res < 0) and (errno == EINTR))
+    {
+        return true;    // Checked again in the next call
+    }
+    else
+    {
+        this->SetWaitError();
+    }
+
+    return false;
+}
+
+void Subprocess::Kill()
+{
+    if (this->pid > 0)
+    {
+        kill(-this->pid, SIGKILL);
+
+        this->Wait();
+    }
+}
+
+int Subprocess::Run(const vector<string> &args, bool quiet)
+{
+    Subprocess process;
+
+    process.Start(args, quiet);
+
+    return process.Wait();
+}
+
+void Subprocess::SetExitStatus(int status)
+{
+    if (WIFEXITED(status))
+    {
+        this->exit_code = WEXITSTATUS(status);
+    }
+    else
+    {
+        this->exit_code = SUBPROCESS_EXIT_SIGNAL;
+    }
+
+    this->pid = -1;
+}
+
+void Subprocess::SetWaitError()
+{
+    this->exit_code = SUBPROCESS_EXIT_ERROR;
+    this->pid       = -1;
+}
+
+//! \} End of subprocess group
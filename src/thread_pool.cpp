@@ -0,0 +1,215 @@
+/*
+ * thread_pool.cpp
+ * 
+ * Copyright (C) 2020, Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ * 
+ * This file is part of CEST library.
+ * 
+ * CEST library is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * CEST library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with CEST library. If not, see <http://www.gnu.org/licenses/>.
+ * 
+ */
+
+/**
+ * \brief Thread pool implementation.
+ * 
+ * \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ * 
+ * \version 0.1.0
+ * 
+ * \date 18/10/2026
+ * 
+ * \addtogroup thread-pool
+ * \{
+ */
+
+#include <cest/thread_pool.h>
+
+using namespace std;
+
+ThreadPool::ThreadPool(unsigned int n)
+{
+    this->task              = nullptr;
+    this->tasks             = 0;
+    this->next_task         = 0;
+    this->finished_tasks    = 0;
+    this->generation        = 0;
+    this->stop              = false;
+
+    this->SetNumberOfThreads(n);
+}
+
+ThreadPool::~ThreadPool()
+{
+    this->Stop();
+}
+
+void ThreadPool::SetNumberOfThreads(unsigned int n)
+{
+    if (n == 0)
+    {
+        n = max(thread::hardware_concurrency(), 1U);
+    }
+
+    if (n == this->GetNumberOfThreads())
+    {
+        return;
+    }
+
+    this->Stop();
+
+    this->stop = false;
+
+    for(unsigned int i=0; i<n-1; i++)
+    {
+        this->workers.push_back(thread(&ThreadPool::Worker, this));
+    }
+}
+
+unsigned int ThreadPool::GetNumberOfThreads()
+{
+    return this->workers.size() + 1;
+}
+
+void ThreadPool::Run(unsigned int n, const function<void(unsigned int)> &task)
+{
+    if (this->workers.empty())
+    {
+        exception_ptr first_error;
+
+        for(unsigned int i=0; i<n; i++)
+        {
+            try
+            {
+                task(i);
+            }
+            catch(...)
+            {
+                if (!first_error)
+                {
+                    first_error = current_exception();
+                }
+            }
+        }
+
+        if (first_error)
+        {
+            rethrow_exception(first_error);
+        }
+
+        return;
+    }
+
+    unique_lock<mutex> lock(this->pool_mutex);
+
+    this->task              = &task;
+    this->tasks             = n;
+    this->next_task         = 0;
+    this->finished_tasks    = 0;
+    this->error             = nullptr;
+    this->generation++;
+
+    this->start.notify_all();
+
+    this->RunTasks(lock);
+
+    this->done.wait(lock, [this] { return this->finished_tasks == this->tasks; });
+
+    this->task = nullptr;
+
+    exception_ptr first_error = this->error;
+
+    this->error = nullptr;
+
+    lock.unlock();
+
+    if (first_error)
+    {
+        rethrow_exception(first_error);
+    }
+}
+
+void ThreadPool::Worker()
+{
+    unsigned long last_generation = 0;
+
+    unique_lock<mutex> lock(this->pool_mutex);
+
+    while(true)
+    {
+        this->start.wait(lock, [&] { return this->stop or (this->generation != last_generation); });
+
+        if (this->stop)
+        {
+            return;
+        }
+
+        last_generation = this->generation;
+
+        this->RunTasks(lock);
+    }
+}
+
+void ThreadPool::RunTasks(unique_lock<mutex> &lock)
+{
+    while(this->next_task < this->tasks)
+    {
+        unsigned int i = this->next_task++;
+
+        lock.unlock();
+
+        exception_ptr task_error;
+
+        try
+        {
+            (*this->task)(i);
+        }
+        catch(...)
+        {
+            task_error = current_exception();
+        }
+
+        lock.lock();
+
+        // A failed task is also finished, so the run always ends
+        if (task_error and !this->error)
+        {
+            this->error = task_error;
+        }
+
+        if (++this->finished_tasks == this->tasks)
+        {
+            this->done.notify_all();
+        }
+    }
+}
+
+void ThreadPool::Stop()
+{
+    {
+        lock_guard<mutex> lock(this->pool_mutex);
+
+        this->stop = true;
+    }
+
+    this->start.notify_all();
+
+    for(unsigned int i=0; i<this->workers.size(); i++)
+    {
+        this->workers[i].join();
+    }
+
+    this->workers.clear();
+}
+
+//! \} End of thread-pool group
@@ -0,0 +1,186 @@
+/*
+ * threshold_kernel.cpp
+ * 
+ * Copyright (C) 2020, Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ * 
+ * This file is part of CEST library.
+ * 
+ * CEST library is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * CEST library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with CEST library. If not, see <http://www.gnu.org/licenses/>.
+ * 
+ */
+
+/**
+ * \brief Threshold-and-compact kernel implementation.
+ * 
+ * \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ * 
+ * \version 0.1.0
+ * 
+ * \date 18/10/2026
+ * 
+ * \addtogroup threshold-kernel
+ * \{
+ */
+
+#include <cest/threshold_kernel.h>
+
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#define THRESHOLD_KERNEL_X86
+#include <immintrin.h>
+#endif
+
+/**
+ * \brief Scalar kernel (used on any CPU and to process the end of a line).
+ */
+static unsigned int ThresholdScalar(const uint8_t *pix, unsigned int n, uint8_t thr, unsigned int *idx)
+{
+    unsigned int count = 0;
+
+    for(unsigned int i=0; i<n; i++)
+    {
+        idx[count] = i;
+        count += (pix[i] > thr) ? 1 : 0;     // Branchless compaction
+    }
+
+    return count;
+}
+
+#ifdef THRESHOLD_KERNEL_X86
+/**
+ * \brief SSE2 kernel (16 pixels per comparison).
+ *
+ * SSE2 has only signed byte comparisons, so the pixels and the threshold are biased by 0x80 before comparing.
+ */
+__attribute__((target("sse2")))
+static unsigned int ThresholdSSE2(const uint8_t *pix, unsigned int n, uint8_t thr, unsigned int *idx)
+{
+    const __m128i bias = _mm_set1_epi8((char)0x80);
+    const __m128i thr_v = _mm_set1_epi8((char)(thr ^ 0x80));
+
+    unsigned int count = 0;
+    unsigned int i = 0;
+
+    for(; i+16<=n; i+=16)
+    {
+        __m128i v = _mm_loadu_si128((const __m128i*)(pix + i));
+        unsigned int mask = _mm_movemask_epi8(_mm_cmpgt_epi8(_mm_xor_si128(v, bias), thr_v));
+
+        while(mask)
+        {
+            idx[count++] = i + __builtin_ctz(mask);
+            mask &= mask - 1;
+        }
+    }
+
+    unsigned int tail = ThresholdScalar(pix + i, n - i, thr, idx + count);
+
+    for(unsigned int k=count; k<count+tail; k++)
+    {
+        idx[k] += i;
+    }
+
+    return count + tail;
+}
+
+/**
+ * \brief AVX2 kernel (32 pixels per comparison).
+ */
+__attribute__((target("avx2")))
+static unsigned int ThresholdAVX2(const uint8_t *pix, unsigned int n, uint8_t thr, unsigned int *idx)
+{
+    const __m256i bias = _mm256_set1_epi8((char)0x80);
+    const __m256i thr_v = _mm256_set1_epi8((char)(thr ^ 0x80));
+
+    unsigned int count = 0;
+    unsigned int i = 0;
+
+    for(; i+32<=n; i+=32)
+    {
+        __m256i v = _mm256_loadu_si256((const __m256i*)(pix + i));
+        unsigned int mask = (unsigned int)_mm256_movemask_epi8(_mm256_cmpgt_epi8(_mm256_xor_si256(v, bias), thr_v));
+
+        while(mask)
+        {
+            idx[count++] = i + __builtin_ctz(mask);
+            mask &= mask - 1;
+        }
+    }
+
+    unsigned int tail = ThresholdSSE2(pix + i, n - i, thr, idx + count);
+
+    for(unsigned int k=count; k<count+tail; k++)
+    {
+        idx[k] += i;
+    }
+
+    return count + tail;
+}
+#endif // THRESHOLD_KERNEL_X86
+
+ThresholdKernel::ThresholdKernel()
+{
+    this->SetInstructionSet(THRESHOLD_KERNEL_AVX2);
+}
+
+ThresholdKernel::~ThresholdKernel()
+{
+
+}
+
+void ThresholdKernel::SetInstructionSet(int isa)
+{
+    this->kernel = ThresholdScalar;
+    this->isa = THRESHOLD_KERNEL_SCALAR;
+
+#ifdef THRESHOLD_KERNEL_X86
+    __builtin_cpu_init();
+
+    if ((isa >= THRESHOLD_KERNEL_AVX2) and __builtin_cpu_supports("avx2"))
+    {
+        this->kernel = ThresholdAVX2;
+        this->isa = THRESHOLD_KERNEL_AVX2;
+    }
+    else if ((isa >= THRESHOLD_KERNEL_SSE2) and __builtin_cpu_supports("sse2"))
+    {
+        this->kernel = ThresholdSSE2;
+        this->isa = THRESHOLD_KERNEL_SSE2;
+    }
+#endif // THRESHOLD_KERNEL_X86
+}
+
+int ThresholdKernel::GetInstructionSet()
+{
+    return this->isa;
+}
+
+unsigned int ThresholdKernel::Run(const uint8_t *pix, unsigned int n, unsigned int step, uint8_t thr, unsigned int *idx)
+{
+    if (step == 1)
+    {
+        return this->kernel(pix, n, thr, idx);
+    }
+
+    // Interleaved pixels (ex.: one channel of a color image)
+    unsigned int count = 0;
+
+    for(unsigned int i=0; i<n; i++)
+    {
+        idx[count] = i;
+        count += (pix[i*step] > thr) ? 1 : 0;
+    }
+
+    return count;
+}
+
+//! \} End of threshold-kernel group
@@ -0,0 +1,164 @@
+--
+-- cdpu.vhd
+-- 
+-- Copyright (C) 2020, Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+-- 
+-- This file is part of CEST library.
+-- 
+-- CEST library is free software: you can redistribute it and/or modify
+-- it under the terms of the GNU Lesser General Public License as published by
+-- the Free Software Foundation, either version 3 of the License, or
+-- (at your option) any later version.
+-- 
+-- CEST library is distributed in the hope that it will be useful,
+-- but WITHOUT ANY WARRANTY; without even the implied warranty of
+-- MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+-- GNU Lesser General Public License for more details.
+-- 
+-- You should have received a copy of the GNU Lesser General Public License
+-- along with CEST library. If not, see <http://www.gnu.org/licenses/>.
+-- 
+--
+
+--! 
+--! \brief CentroiD Processor Unit (fixed-point).
+--! 
+--! \details It implements the same datapath of the CDPUFixed class (C++): the pixel weight (G) and the correction
+--!          factor are in Q0.GAIN_BITS format, and the centroid position in Q(COORD_BITS).POS_BITS format. All the
+--!          products are truncated back to the storage format.
+--! 
+--! \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+--! 
+--! \version 0.1.0
+--! 
+--! \date 18/10/2026
+--! 
+
+library ieee;
+    use ieee.std_logic_1164.all;
+    use ieee.numeric_std.all;
+
+entity CDPU is
+    generic(
+        DATA_BITS   : natural := 8;                                             --! Pixel width in bits.
+        COORD_BITS  : natural := 16;                                            --! Integer bits of the position.
+        GAIN_BITS   : natural := 16;                                            --! Fractional bits of the pixel weight.
+        POS_BITS    : natural := 8;                                             --! Fractional bits of the position.
+        CORR_FACTOR : natural := 52429;                                         --! Correction factor (Q0.GAIN_BITS).
+        GATE        : natural := 8                                              --! Update distance threshold (Manhattan distance).
+        );
+    port(
+        clk         : in std_logic;                                             --! Star pixel strobe (falling edge).
+        init        : in std_logic;                                             --! Starts a new centroid with the input pixel.
+        x_in        : in std_logic_vector(COORD_BITS-1 downto 0);               --! x position of the star pixel.
+        y_in        : in std_logic_vector(COORD_BITS-1 downto 0);               --! y position of the star pixel.
+        pix_in      : in std_logic_vector(DATA_BITS-1 downto 0);                --! Value of the star pixel.
+        dist        : out std_logic_vector(COORD_BITS downto 0);                --! Distance from the centroid to the star pixel.
+        active      : out std_logic;                                            --! High when the CDPU is in use.
+        updated     : out std_logic;                                            --! High when the last star pixel updated the CDPU.
+        x_out       : out std_logic_vector(COORD_BITS+POS_BITS-1 downto 0);     --! x position of the centroid.
+        y_out       : out std_logic_vector(COORD_BITS+POS_BITS-1 downto 0);     --! y position of the centroid.
+        value_out   : out std_logic_vector(DATA_BITS-1 downto 0);               --! Value of the centroid.
+        pixels_out  : out std_logic_vector(31 downto 0)                         --! Number of pixels of the centroid.
+        );
+end CDPU;
+
+architecture behavior of CDPU is
+
+    constant POS_WIDTH  : natural := COORD_BITS + POS_BITS;
+    constant G_WIDTH    : natural := GAIN_BITS + 1;                             -- G = 1.0 is a valid value
+
+    signal x_reg        : unsigned(POS_WIDTH-1 downto 0) := (others => '0');
+    signal y_reg        : unsigned(POS_WIDTH-1 downto 0) := (others => '0');
+    signal value_reg    : unsigned(DATA_BITS-1 downto 0) := (others => '0');
+    signal pixels_reg   : unsigned(31 downto 0) := (others => '0');
+    signal g_reg        : unsigned(G_WIDTH-1 downto 0) := to_unsigned(2**GAIN_BITS, G_WIDTH);
+    signal active_reg   : std_logic := '0';
+    signal updated_reg  : std_logic := '0';
+
+    -- Manhattan distance with the distance of each axis truncated to an integer (as in the CDPUFixed class)
+    function distance(x_c, y_c : unsigned; x_p, y_p : unsigned) return unsigned is
+        variable dx : unsigned(POS_WIDTH-1 downto 0);
+        variable dy : unsigned(POS_WIDTH-1 downto 0);
+    begin
+        if (x_c >= x_p) then
+            dx := x_c - x_p;
+        else
+            dx := x_p - x_c;
+        end if;
+
+        if (y_c >= y_p) then
+            dy := y_c - y_p;
+        else
+            dy := y_p - y_c;
+        end if;
+
+        return resize(shift_right(dx, POS_BITS), COORD_BITS+1) + resize(shift_right(dy, POS_BITS), COORD_BITS+1);
+    end function;
+
+    signal x_pix        : unsigned(POS_WIDTH-1 downto 0);
+    signal y_pix        : unsigned(POS_WIDTH-1 downto 0);
+
+begin
+
+    x_pix <= shift_left(resize(unsigned(x_in), POS_WIDTH), POS_BITS);
+    y_pix <= shift_left(resize(unsigned(y_in), POS_WIDTH), POS_BITS);
+
+    process(clk)
+        variable x_v        : unsigned(POS_WIDTH-1 downto 0);
+        variable y_v        : unsigned(POS_WIDTH-1 downto 0);
+        variable value_v    : unsigned(DATA_BITS-1 downto 0);
+        variable pixels_v   : unsigned(31 downto 0);
+        variable g_v        : unsigned(G_WIDTH-1 downto 0);
+        variable g_inv      : unsigned(G_WIDTH-1 downto 0);
+        variable upd_v      : std_logic;
+    begin
+        if falling_edge(clk) then
+            x_v         := x_reg;
+            y_v         := y_reg;
+            value_v     := value_reg;
+            pixels_v    := pixels_reg;
+            g_v         := g_reg;
+            upd_v       := '0';
+
+            -- New centroid (SetCentroid), updated with the same pixel in the same cycle
+            if (init = '1') then
+                x_v         := x_pix;
+                y_v         := y_pix;
+                value_v     := value_v + unsigned(pix_in);
+                pixels_v    := to_unsigned(1, 32);
+                active_reg  <= '1';
+                upd_v       := '1';
+            end if;
+
+            -- Update
+            if (((active_reg = '1') or (init = '1')) and (distance(x_v, y_v, x_pix, y_pix) < GATE)) then
+                g_v     := resize(shift_right(g_v*to_unsigned(CORR_FACTOR, G_WIDTH), GAIN_BITS), G_WIDTH);
+                g_inv   := to_unsigned(2**GAIN_BITS, G_WIDTH) - g_v;
+
+                x_v     := resize(shift_right(g_v*x_v + g_inv*x_pix, GAIN_BITS), POS_WIDTH);
+                y_v     := resize(shift_right(g_v*y_v + g_inv*y_pix, GAIN_BITS), POS_WIDTH);
+                value_v := resize(shift_right(g_v*value_v + g_inv*unsigned(pix_in), GAIN_BITS), DATA_BITS);
+
+                pixels_v    := pixels_v + 1;
+                upd_v       := '1';
+            end if;
+
+            x_reg       <= x_v;
+            y_reg       <= y_v;
+            value_reg   <= value_v;
+            pixels_reg  <= pixels_v;
+            g_reg       <= g_v;
+            updated_reg <= upd_v;
+        end if;
+    end process;
+
+    dist        <= std_logic_vector(distance(x_reg, y_reg, x_pix, y_pix));
+    active      <= active_reg;
+    updated     <= updated_reg;
+    x_out       <= std_logic_vector(x_reg);
+    y_out       <= std_logic_vector(y_reg);
+    value_out   <= std_logic_vector(value_reg);
+    pixels_out  <= std_logic_vector(pixels_reg);
+
+end behavior;
@@ -0,0 +1,164 @@
+--
+-- cdpu_bank.vhd
+-- 
+-- Copyright (C) 2020, Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+-- 
+-- This file is part of CEST library.
+-- 
+-- CEST library is free software: you can redistribute it and/or modify
+-- it under the terms of the GNU Lesser General Public License as published by
+-- the Free Software Foundation, either version 3 of the License, or
+-- (at your option) any later version.
+-- 
+-- CEST library is distributed in the hope that it will be useful,
+-- but WITHOUT ANY WARRANTY; without even the implied warranty of
+-- MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+-- GNU Lesser General Public License for more details.
+-- 
+-- You should have received a copy of the GNU Lesser General Public License
+-- along with CEST library. If not, see <http://www.gnu.org/licenses/>.
+-- 
+--
+
+--! 
+--! \brief Bank of CentroiD Processor Units.
+--! 
+--! \details It implements the same algorithm of the CentroiderFixed class (C++): a star pixel starts a new centroid
+--!          when it is not captured by any CDPU in use (and there is a free CDPU), and then it updates all the CDPUs in
+--!          use. The CDPUs are allocated in order, so the CDPU index is the same of the software centroider.
+--!          The state of all the CDPUs is given by the output ports (one slice per CDPU, with the CDPU 0 in the least
+--!          significant bits), with the CDPUs updated by the last star pixel flagged in the updated port. The state is
+--!          logged by the CDPULog block (simulation only).
+--! 
+--! \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+--! 
+--! \version 0.1.0
+--! 
+--! \date 18/10/2026
+--! 
+
+library ieee;
+    use ieee.std_logic_1164.all;
+    use ieee.numeric_std.all;
+
+entity CDPUBank is
+    generic(
+        DATA_BITS           : natural := 8;                                     --! Pixel width in bits.
+        X_POS_BITS          : natural := 10;                                    --! Length of the x position data.
+        Y_POS_BITS          : natural := 10;                                    --! Length of the y position data.
+        MAX_CDPUS           : natural := 20;                                    --! Number of CDPUs.
+        DISTANCE_THRESHOLD  : natural := 10;                                    --! Distance threshold to capture a star pixel.
+        GAIN_BITS           : natural := 16;                                    --! Fractional bits of the pixel weight.
+        POS_BITS            : natural := 8;                                     --! Fractional bits of the position.
+        CORR_FACTOR         : natural := 52429;                                 --! Correction factor (Q0.GAIN_BITS).
+        GATE                : natural := 8;                                     --! Update distance threshold of the CDPUs.
+        COORD_BITS          : natural := 16                                     --! Integer bits of the position.
+        );
+    port(
+        en                  : in std_logic;                                     --! Star pixel strobe (falling edge, as the Log block).
+        x_pos               : in std_logic_vector(X_POS_BITS-1 downto 0);       --! x position of the star pixel.
+        y_pos               : in std_logic_vector(Y_POS_BITS-1 downto 0);       --! y position of the star pixel.
+        pix_val             : in std_logic_vector(DATA_BITS-1 downto 0);        --! Value of the star pixel.
+        updated             : out std_logic_vector(MAX_CDPUS-1 downto 0);       --! High for the CDPUs updated by the last star pixel.
+        x_out               : out std_logic_vector(MAX_CDPUS*(COORD_BITS+POS_BITS)-1 downto 0); --! x positions of the centroids.
+        y_out               : out std_logic_vector(MAX_CDPUS*(COORD_BITS+POS_BITS)-1 downto 0); --! y positions of the centroids.
+        value_out           : out std_logic_vector(MAX_CDPUS*DATA_BITS-1 downto 0);             --! Values of the centroids.
+        pixels_out          : out std_logic_vector(MAX_CDPUS*32-1 downto 0)                     --! Number of pixels of the centroids.
+        );
+end CDPUBank;
+
+architecture behavior of CDPUBank is
+
+    component CDPU is
+        generic(
+            DATA_BITS   : natural := 8;                                         --! Pixel width in bits.
+            COORD_BITS  : natural := 16;                                        --! Integer bits of the position.
+            GAIN_BITS   : natural := 16;                                        --! Fractional bits of the pixel weight.
+            POS_BITS    : natural := 8;                                         --! Fractional bits of the position.
+            CORR_FACTOR : natural := 52429;                                     --! Correction factor (Q0.GAIN_BITS).
+            GATE        : natural := 8                                          --! Update distance threshold (Manhattan distance).
+            );
+        port(
+            clk         : in std_logic;                                         --! Star pixel strobe (falling edge).
+            init        : in std_logic;                                         --! Starts a new centroid with the input pixel.
+            x_in        : in std_logic_vector(COORD_BITS-1 downto 0);           --! x position of the star pixel.
+            y_in        : in std_logic_vector(COORD_BITS-1 downto 0);           --! y position of the star pixel.
+            pix_in      : in std_logic_vector(DATA_BITS-1 downto 0);            --! Value of the star pixel.
+            dist        : out std_logic_vector(COORD_BITS downto 0);            --! Distance from the centroid to the star pixel.
+            active      : out std_logic;                                        --! High when the CDPU is in use.
+            updated     : out std_logic;                                        --! High when the last star pixel updated the CDPU.
+            x_out       : out std_logic_vector(COORD_BITS+POS_BITS-1 downto 0); --! x position of the centroid.
+            y_out       : out std_logic_vector(COORD_BITS+POS_BITS-1 downto 0); --! y position of the centroid.
+            value_out   : out std_logic_vector(DATA_BITS-1 downto 0);           --! Value of the centroid.
+            pixels_out  : out std_logic_vector(31 downto 0)                     --! Number of pixels of the centroid.
+            );
+    end component;
+
+    constant POS_WIDTH  : natural := COORD_BITS+POS_BITS;
+
+    type dist_arr_t is array (0 to MAX_CDPUS-1) of std_logic_vector(COORD_BITS downto 0);
+
+    constant NO_CAPTURE : std_logic_vector(MAX_CDPUS-1 downto 0) := (others => '0');
+
+    -- The inputs are seen one delta cycle after the position counters, so the strobe edge samples the same values of the Log block
+    signal x_pos_val    : std_logic_vector(COORD_BITS-1 downto 0);
+    signal y_pos_val    : std_logic_vector(COORD_BITS-1 downto 0);
+    signal pix_value    : std_logic_vector(DATA_BITS-1 downto 0);
+
+    signal dist         : dist_arr_t;
+    signal active       : std_logic_vector(MAX_CDPUS-1 downto 0);
+    signal capture      : std_logic_vector(MAX_CDPUS-1 downto 0);
+    signal init         : std_logic_vector(MAX_CDPUS-1 downto 0);
+    signal alloc        : std_logic;
+    signal used         : natural range 0 to MAX_CDPUS := 0;                    -- Number of CDPUs in use
+
+begin
+
+    x_pos_val <= std_logic_vector(resize(unsigned(x_pos), COORD_BITS));
+    y_pos_val <= std_logic_vector(resize(unsigned(y_pos), COORD_BITS));
+    pix_value <= pix_val;
+
+    CDPUS : for k in 0 to MAX_CDPUS-1 generate
+
+        capture(k) <= '1' when ((active(k) = '1') and (unsigned(dist(k)) < DISTANCE_THRESHOLD)) else '0';
+
+        init(k) <= '1' when ((alloc = '1') and (used = k)) else '0';
+
+        CDPU_K : CDPU   generic map(
+                            DATA_BITS   => DATA_BITS,
+                            COORD_BITS  => COORD_BITS,
+                            GAIN_BITS   => GAIN_BITS,
+                            POS_BITS    => POS_BITS,
+                            CORR_FACTOR => CORR_FACTOR,
+                            GATE        => GATE
+                            )
+                        port map(
+                            clk         => en,
+                            init        => init(k),
+                            x_in        => x_pos_val,
+                            y_in        => y_pos_val,
+                            pix_in      => pix_value,
+                            dist        => dist(k),
+                            active      => active(k),
+                            updated     => updated(k),
+                            x_out       => x_out((k+1)*POS_WIDTH-1 downto k*POS_WIDTH),
+                            y_out       => y_out((k+1)*POS_WIDTH-1 downto k*POS_WIDTH),
+                            value_out   => value_out((k+1)*DATA_BITS-1 downto k*DATA_BITS),
+                            pixels_out  => pixels_out((k+1)*32-1 downto k*32)
+                            );
+
+    end generate;
+
+    -- A new centroid is started when no CDPU in use captures the star pixel
+    alloc <= '1' when ((used < MAX_CDPUS) and (capture = NO_CAPTURE)) else '0';
+
+    process(en)
+    begin
+        if falling_edge(en) then
+            if (alloc = '1') then
+                used <= used + 1;
+            end if;
+        end if;
+    end process;
+
+end behavior;
@@ -0,0 +1,112 @@
+--
+-- cdpu_log.vhd
+-- 
+-- Copyright (C) 2020, Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+-- 
+-- This file is part of CEST library.
+-- 
+-- CEST library is free software: you can redistribute it and/or modify
+-- it under the terms of the GNU Lesser General Public License as published by
+-- the Free Software Foundation, either version 3 of the License, or
+-- (at your option) any later version.
+-- 
+-- CEST library is distributed in the hope that it will be useful,
+-- but WITHOUT ANY WARRANTY; without even the implied warranty of
+-- MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+-- GNU Lesser General Public License for more details.
+-- 
+-- You should have received a copy of the GNU Lesser General Public License
+-- along with CEST library. If not, see <http://www.gnu.org/licenses/>.
+-- 
+--
+
+--! 
+--! \brief Log of the CDPU bank state (simulation only).
+--! 
+--! \details The state of the CDPUs updated by each star pixel is logged ("k,x,y,value,pixels") on the first clock
+--!          edge after the star pixel, so the last line of each CDPU is its final centroid.
+--! 
+--! \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+--! 
+--! \version 0.1.0
+--! 
+--! \date 18/10/2026
+--! 
+
+library ieee;
+    use ieee.std_logic_1164.all;
+    use ieee.numeric_std.all;
+    use std.textio.all;
+
+entity CDPULog is
+    generic(
+        DATA_BITS   : natural := 8;                                                 --! Pixel width in bits.
+        POS_WIDTH   : natural := 24;                                                --! Length of the position data (integer and fractional bits).
+        MAX_CDPUS   : natural := 20;                                                --! Number of CDPUs.
+        FILE_NAME   : string := "centroids.csv"                                     --! Output log file name.
+        );
+    port(
+        clk         : in std_logic;                                                 --! Reference clock.
+        en          : in std_logic;                                                 --! Star pixel strobe (falling edge, as the CDPU bank).
+        updated     : in std_logic_vector(MAX_CDPUS-1 downto 0);                    --! High for the CDPUs updated by the last star pixel.
+        x_in        : in std_logic_vector(MAX_CDPUS*POS_WIDTH-1 downto 0);          --! x positions of the centroids.
+        y_in        : in std_logic_vector(MAX_CDPUS*POS_WIDTH-1 downto 0);          --! y positions of the centroids.
+        value_in    : in std_logic_vector(MAX_CDPUS*DATA_BITS-1 downto 0);          --! Values of the centroids.
+        pixels_in   : in std_logic_vector(MAX_CDPUS*32-1 downto 0)                  --! Number of pixels of the centroids.
+        );
+end CDPULog;
+
+architecture behavior of CDPULog is
+
+    file log_file       : text;
+
+    signal strobes      : natural := 0;                                             -- Number of star pixels
+
+begin
+
+    -- The log file is created at the start of the simulation, so a missing log is a failed simulation
+    process
+    begin
+        file_open(log_file, FILE_NAME, write_mode);
+        file_close(log_file);
+
+        wait;
+    end process;
+
+    process(en)
+    begin
+        if falling_edge(en) then
+            strobes <= strobes + 1;
+        end if;
+    end process;
+
+    process(clk)
+        variable log_line   : line;
+        variable logged     : natural := 0;
+    begin
+        if rising_edge(clk) and (strobes /= logged) then
+            logged := strobes;
+
+            file_open(log_file, FILE_NAME, append_mode);
+
+            for k in 0 to MAX_CDPUS-1 loop
+                if (updated(k) = '1') then
+                    write(log_line, integer'image(k), right, 1);
+                    write(log_line, string'(","));
+                    write(log_line, integer'image(to_integer(unsigned(x_in((k+1)*POS_WIDTH-1 downto k*POS_WIDTH)))), right, 1);
+                    write(log_line, string'(","));
+                    write(log_line, integer'image(to_integer(unsigned(y_in((k+1)*POS_WIDTH-1 downto k*POS_WIDTH)))), right, 1);
+                    write(log_line, string'(","));
+                    write(log_line, integer'image(to_integer(unsigned(value_in((k+1)*DATA_BITS-1 downto k*DATA_BITS)))), right, 1);
+                    write(log_line, string'(","));
+                    write(log_line, integer'image(to_integer(unsigned(pixels_in((k+1)*32-1 downto k*32)))), right, 1);
+
+                    writeline(log_file, log_line);
+                end if;
+            end loop;
+
+            file_close(log_file);
+        end if;
+    end process;
+
+end behavior;
@@ -47,7 +47,7 @@ entity Counter is
         en          : in std_logic;                                                             --! Enable signal.
         dir         : in std_logic;                                                             --! Counting direction ('1' = up, '0' = down).
         rst         : in std_logic;                                                             --! Resets counting (go back to 0).
-        output      : out std_logic_vector(natural(ceil(log2(real(UPPER_LIMIT))))-1 downto 0)   --! Counter output.
+        output      : out std_logic_vector(natural(ceil(log2(real(UPPER_LIMIT+1))))-1 downto 0)   --! Counter output.
         );
 end Counter;
 
@@ -43,7 +43,8 @@ entity Log is
         X_POS_BITS  : natural := 8;                                     --! Length of the x position data.
         Y_POS_BITS  : natural := 8;                                     --! Length of the y position data.
         PRINT_DATA  : boolean := FALSE;                                 --! TRUE/FALSE to print the log data on the screen.
-        FILE_NAME   : string := "star_pixels.csv"                       --! Output log file name.
+        FILE_NAME   : string := "star_pixels.csv";                      --! Output log file name.
+        BINARY      : boolean := FALSE                                  --! TRUE/FALSE to write binary records (value, x and y as 16-bit little-endian values) instead of CSV lines.
         );
     port(
         log_data    : in std_logic;                                     --! Enables a log line writing.
@@ -55,7 +56,10 @@ end Log;
 
 architecture behavior of Log is
 
+    type char_file_t is file of character;
+
     file log_file       : text; 
+    file bin_file       : char_file_t;
 
     signal x_pos_val    : std_logic_vector(X_POS_BITS-1 downto 0);
     signal y_pos_val    : std_logic_vector(Y_POS_BITS-1 downto 0);
@@ -67,13 +71,37 @@ architecture behavior of Log is
     y_pos_val <= y_pos;
     pix_value <= pix_val;
 
+    -- The log file is created at the start of the simulation, so an empty log is not mistaken for a failed simulation
+    process
+    begin
+        if (BINARY = TRUE) then
+            file_open(bin_file, FILE_NAME, write_mode);                 -- Kept open until the end of the simulation
+        else
+            file_open(log_file, FILE_NAME, write_mode);
+            file_close(log_file);
+        end if;
+
+        wait;
+    end process;
+
     process(log_data)
 
         variable log_line   : line;
 
+        -- Writes a 16-bit little-endian value to the binary file
+        procedure write_half(constant half_v : in natural) is
+        begin
+            write(bin_file, character'val(half_v mod 256));
+            write(bin_file, character'val((half_v / 256) mod 256));
+        end procedure;
+
         begin
 
-        if falling_edge(log_data) then
+        if falling_edge(log_data) and (BINARY = TRUE) then
+            write_half(to_integer(unsigned(pix_value)));
+            write_half(to_integer(unsigned(x_pos_val)));
+            write_half(to_integer(unsigned(y_pos_val)));
+        elsif falling_edge(log_data) then
             file_open(log_file, FILE_NAME, append_mode);                -- Opens the file in "append mode".
 
             if (PRINT_DATA = TRUE) then
@@ -42,7 +42,11 @@ library std;
 entity Sensor is
     generic(
         DATA_BITS   : natural := 8;                             --! Pixel size in bits (Sensor dependent).
-        CHANNELS    : natural := 3                              --! Pixel channels.
+        CHANNELS    : natural := 3;                             --! Pixel channels.
+        IMAGE_FILE  : string := "/tmp/img_buf.pgm";             --! Input image file (Netpbm or raw).
+        IMAGE_WIDTH : natural := 800;                           --! Image width in pixels.
+        IMAGE_HEIGHT : natural := 600;                          --! Image height in pixels.
+        RAW_INPUT   : boolean := FALSE                          --! TRUE/FALSE to read a raw image (no header, 1 byte per pixel, or 2 bytes little-endian if DATA_BITS > 8).
         );
     port(
         clk     : in std_logic;                                 --! Clock source.
@@ -59,9 +63,6 @@ architecture behavior of Sensor is
     type t_ppm_file is file of character;
     type t_byte_arr is array (natural range <>) of bit_vector(7 downto 0);
  
-    constant IMAGE_WIDTH            : natural := 800;
-    constant IMAGE_HEIGTH           : natural := 600;
-    constant IMAGE_FILE             : string := "/tmp/img_buf.pgm";
     constant BLANK_REGION_CLKS      : natural := 15;
  
     signal read_arr_byte            : t_byte_arr(0 to 199);
@@ -84,6 +85,7 @@ begin
         variable char_v         : character;
         subtype byte_t is natural range 0 to 255;
         variable byte_v         : byte_t;
+        variable pixel_v        : natural;
  
     begin
  
@@ -102,7 +104,7 @@ begin
             read(ppm_file, char_v);
             byte_v := character'pos(char_v);
 
-            if (header_ready = '0') then
+            if ((header_ready = '0') and (RAW_INPUT = FALSE)) then
                 hsync <= '0';
 
                 if (byte_dump = '1') then
@@ -191,7 +193,15 @@ begin
                 vsync <= '1';
                 hsync <= '1';
 
-                data <= std_logic_vector(to_unsigned(byte_v, DATA_BITS));
+                pixel_v := byte_v;
+
+                -- Raw pixels wider than 8 bits are read as 16-bit little-endian values
+                if ((RAW_INPUT = TRUE) and (DATA_BITS > 8)) then
+                    read(ppm_file, char_v);
+                    pixel_v := pixel_v + 256*character'pos(char_v);
+                end if;
+
+                data <= std_logic_vector(to_unsigned(pixel_v, DATA_BITS));
  
                 wait until falling_edge(clk);
                 pixclk <= '0';
@@ -212,7 +222,7 @@ begin
                     column_counter <= column_counter + 1;
                 end if;
 
-                if (line_counter = (IMAGE_HEIGTH-1)) then
+                if (line_counter = (IMAGE_HEIGHT-1)) then
                     vsync <= '0';
                     line_counter <= 0;
                     assert false report "End of image reached!" severity failure;
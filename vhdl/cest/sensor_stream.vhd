@@ -0,0 +1,180 @@
+--
+-- sensor_stream.vhd
+-- 
+-- Copyright (C) 2020, Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+-- 
+-- This file is part of CEST library.
+-- 
+-- CEST library is free software: you can redistribute it and/or modify
+-- it under the terms of the GNU Lesser General Public License as published by
+-- the Free Software Foundation, either version 3 of the License, or
+-- (at your option) any later version.
+-- 
+-- CEST library is distributed in the hope that it will be useful,
+-- but WITHOUT ANY WARRANTY; without even the implied warranty of
+-- MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+-- GNU Lesser General Public License for more details.
+-- 
+-- You should have received a copy of the GNU Lesser General Public License
+-- along with CEST library. If not, see <http://www.gnu.org/licenses/>.
+-- 
+--
+
+--! 
+--! \brief Streaming sensor simulation block.
+--! 
+--! \details This block simulates an image sensor with frames received from a file (usually a named pipe). Each frame
+--!          is preceded by a header with a command byte ('F' = frame, 'Q' = quit), the threshold value (1 byte), the
+--!          image width (2 bytes, little-endian) and the image height (2 bytes, little-endian), followed by the raw
+--!          8-bit pixels in raster order. The pixel timing of each row is the same of the Sensor block, and so is the end
+--!          of each frame: the last row is read from the file but not sent, as the Sensor block stops the simulation when
+--!          its line counter reaches the last row.
+--! 
+--! \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+--! 
+--! \version 0.1.0
+--! 
+--! \date 18/10/2026
+--! 
+
+library ieee;
+    use ieee.std_logic_1164.all;
+    use ieee.numeric_std.all;
+
+entity SensorStream is
+    generic(
+        DATA_BITS           : natural := 8;                             --! Pixel size in bits.
+        CMD_FILE            : string := "/tmp/cest_cmd";                --! Input file with the frames.
+        BLANK_REGION_CLKS   : natural := 15                             --! Clock cycles between two rows.
+        );
+    port(
+        clk         : in std_logic;                                     --! Clock source.
+        pixclk      : out std_logic;                                    --! Pixel clock.
+        hsync       : out std_logic;                                    --! Horizontal sync. (Low at the end of a line).
+        vsync       : out std_logic;                                    --! Vertical sync. (Low between two frames).
+        data        : out std_logic_vector(DATA_BITS-1 downto 0);       --! Data output.
+        threshold   : out std_logic_vector(DATA_BITS-1 downto 0);       --! Threshold value of the current frame.
+        frame       : out std_logic                                     --! High while a frame is being sent.
+        );
+end SensorStream;
+
+architecture behavior of SensorStream is
+
+begin
+
+    read_frames : process
+        type char_file_t is file of character;
+        file cmd_file           : char_file_t;
+        variable char_v         : character;
+        variable cmd_v          : natural;
+        variable width_v        : natural;
+        variable height_v       : natural;
+        variable line_v         : natural;
+        variable sending_v      : boolean;
+
+        -- Reads a byte from the input file
+        procedure read_byte(variable byte_v : out natural) is
+        begin
+            read(cmd_file, char_v);
+            byte_v := character'pos(char_v);
+        end procedure;
+
+        -- Reads a 16-bit little-endian value from the input file
+        procedure read_half(variable half_v : out natural) is
+            variable low_v  : natural;
+            variable high_v : natural;
+        begin
+            read_byte(low_v);
+            read_byte(high_v);
+            half_v := low_v + 256*high_v;
+        end procedure;
+
+    begin
+
+        pixclk      <= '0';
+        hsync       <= '0';
+        vsync       <= '0';
+        frame       <= '0';
+        data        <= std_logic_vector(to_unsigned(0, DATA_BITS));
+        threshold   <= std_logic_vector(to_unsigned(0, DATA_BITS));
+
+        file_open(cmd_file, CMD_FILE, read_mode);
+
+        while not endfile(cmd_file) loop
+            read_byte(cmd_v);
+
+            exit when (cmd_v = 81);                                     -- 81 = 0x51 = 'Q'
+
+            if (cmd_v = 70) then                                        -- 70 = 0x46 = 'F'
+                read_byte(cmd_v);
+                threshold <= std_logic_vector(to_unsigned(cmd_v, DATA_BITS));
+
+                read_half(width_v);
+                read_half(height_v);
+
+                -- Resets the line counter (hsync pulse with vsync low)
+                wait until rising_edge(clk);
+                hsync <= '1';
+                wait until falling_edge(clk);
+                hsync <= '0';
+
+                frame <= '1';
+
+                line_v      := 0;
+                sending_v   := true;
+
+                for j in 0 to height_v-1 loop
+                    for i in 0 to width_v-1 loop
+                        read(cmd_file, char_v);
+
+                        if (sending_v) then
+                            wait until rising_edge(clk);
+                            pixclk <= '1';
+
+                            vsync <= '1';
+                            hsync <= '1';
+
+                            data <= std_logic_vector(to_unsigned(character'pos(char_v), DATA_BITS));
+
+                            wait until falling_edge(clk);
+                            pixclk <= '0';
+
+                            if (i = width_v-1) then
+                                hsync <= '0';
+                                line_v := line_v + 1;
+
+                                -- Blank region
+                                for k in 0 to BLANK_REGION_CLKS-1 loop
+                                    wait until rising_edge(clk);
+                                    pixclk <= '1';
+                                    wait until falling_edge(clk);
+                                    pixclk <= '0';
+                                end loop;
+                            end if;
+
+                            -- The same end of image of the Sensor block (the rest of the frame is read but not sent)
+                            if (line_v = height_v-1) then
+                                sending_v := false;
+                            end if;
+                        end if;
+                    end loop;
+                end loop;
+
+                vsync <= '0';
+                frame <= '0';
+
+                -- Lets the other blocks finish the frame before waiting for the next one
+                wait until rising_edge(clk);
+            else
+                assert false report "Unknown command!" severity error;
+            end if;
+        end loop;
+
+        file_close(cmd_file);
+
+        assert false report "End of the frames stream!" severity failure;
+
+        wait;
+    end process;
+
+end behavior;
@@ -0,0 +1,308 @@
+--
+-- starcentroider.vhd
+-- 
+-- Copyright (C) 2020, Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+-- 
+-- This file is part of CEST library.
+-- 
+-- CEST library is free software: you can redistribute it and/or modify
+-- it under the terms of the GNU Lesser General Public License as published by
+-- the Free Software Foundation, either version 3 of the License, or
+-- (at your option) any later version.
+-- 
+-- CEST library is distributed in the hope that it will be useful,
+-- but WITHOUT ANY WARRANTY; without even the implied warranty of
+-- MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+-- GNU Lesser General Public License for more details.
+-- 
+-- You should have received a copy of the GNU Lesser General Public License
+-- along with CEST library. If not, see <http://www.gnu.org/licenses/>.
+-- 
+--
+
+--! 
+--! \brief Star pixels filter and centroider (CDPU bank) for a star tracker simulation.
+--! 
+--! \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+--! 
+--! \version 0.1.0
+--! 
+--! \date 18/10/2026
+--! 
+
+library ieee;
+    use ieee.std_logic_1164.all;
+    use ieee.math_real.all;
+
+entity StarCentroider is
+    generic(
+        STAR_THRESHOLD_VAL : natural := 150;
+        IMAGE_FILE         : string := "/tmp/img_buf.pgm";
+        LOG_FILE           : string := "/tmp/centroids.csv";
+        PIXEL_BITS         : natural := 8;
+        IMG_WIDTH          : natural := 800;
+        IMG_HEIGHT         : natural := 600;
+        RAW_INPUT          : boolean := FALSE;
+        MAX_CDPUS          : natural := 20;
+        DISTANCE_THRESHOLD : natural := 10;
+        GAIN_BITS          : natural := 16;
+        POS_BITS           : natural := 8;
+        CORR_FACTOR        : natural := 52429;
+        GATE               : natural := 8
+        );
+end StarCentroider;
+
+architecture behavior of StarCentroider is
+
+    component Clock is
+        port(
+            clk         : out std_logic
+            );
+    end component;
+
+    component Sensor is
+        generic(
+            DATA_BITS   : natural := 8;                                 --! Pixel size in bits (Sensor dependent).
+            CHANNELS    : natural := 3;                                 --! Pixel channels.
+            IMAGE_FILE  : string := "/tmp/img_buf.pgm";                 --! Input image file (Netpbm or raw).
+            IMAGE_WIDTH : natural := 800;                               --! Image width in pixels.
+            IMAGE_HEIGHT : natural := 600;                              --! Image height in pixels.
+            RAW_INPUT   : boolean := FALSE                              --! TRUE/FALSE to read a raw image.
+            );
+        port(
+            clk         : in std_logic;                                 --! Clock source.
+            rst         : in std_logic;                                 --! Reset pin.
+            pixclk      : out std_logic;                                --! Pixel clock.
+            hsync       : out std_logic;                                --! Horizontal sync.
+            vsync       : out std_logic;                                --! Vertical sync.
+            data        : out std_logic_vector(DATA_BITS-1 downto 0)    --! Data output.
+            );
+    end component;
+
+    component Grayscale is
+        generic(
+            DATA_WIDTH  : natural := 8;
+            IMG_CHS     : natural := 3
+            );
+        port(
+            clk         : in std_logic;
+            rst         : in std_logic;
+            data_in     : in std_logic_vector(DATA_WIDTH-1 downto 0);
+            data_out    : out std_logic_vector(DATA_WIDTH-1 downto 0);
+            pixclk      : out std_logic
+            );
+    end component;
+
+    component Threshold is 
+        generic(
+            DATA_WIDTH  : natural := 8;                                 --! Pixel width in bits.
+            TH_VALUE    : natural := 200                                --! Threshold value (0 to 255).
+            );
+        port(
+            clk         : in std_logic;                                 --! Clock source.
+            en          : in std_logic;                                 --! Enable signal (Activation "clock").
+            data_in     : in std_logic_vector(DATA_WIDTH-1 downto 0);   --! Data input (gray scale pixels).
+            data_out    : out std_logic_vector(DATA_WIDTH-1 downto 0);  --! Data output (above threshold pixels).
+            pixclk      : out std_logic                                 --! Signalizes when to pick the data from the output.
+            );
+    end component;
+
+    component Counter is
+        generic(
+            UPPER_LIMIT : natural := 64;                                                            --! Upper counting limit (Max. value).
+            INIT_VALUE  : natural := 0                                                              --! Initial value.
+            );
+        port(
+            clk         : in std_logic;                                                             --! Reference clock.
+            en          : in std_logic;                                                             --! Enable signal.
+            dir         : in std_logic;                                                             --! Counting direction ('1' = up, '0' = down).
+            rst         : in std_logic;                                                             --! Resets counting (go back to 0).
+            output      : out std_logic_vector(natural(ceil(log2(real(UPPER_LIMIT+1))))-1 downto 0)   --! Counter output.
+            );
+    end component;
+
+    component CDPUBank is
+        generic(
+            DATA_BITS           : natural := 8;                                 --! Pixel width in bits.
+            X_POS_BITS          : natural := 10;                                --! Length of the x position data.
+            Y_POS_BITS          : natural := 10;                                --! Length of the y position data.
+            MAX_CDPUS           : natural := 20;                                --! Number of CDPUs.
+            DISTANCE_THRESHOLD  : natural := 10;                                --! Distance threshold to capture a star pixel.
+            GAIN_BITS           : natural := 16;                                --! Fractional bits of the pixel weight.
+            POS_BITS            : natural := 8;                                 --! Fractional bits of the position.
+            CORR_FACTOR         : natural := 52429;                             --! Correction factor (Q0.GAIN_BITS).
+            GATE                : natural := 8;                                 --! Update distance threshold of the CDPUs.
+            COORD_BITS          : natural := 16                                 --! Integer bits of the position.
+            );
+        port(
+            en                  : in std_logic;                                 --! Star pixel strobe (falling edge, as the Log block).
+            x_pos               : in std_logic_vector(X_POS_BITS-1 downto 0);   --! x position of the star pixel.
+            y_pos               : in std_logic_vector(Y_POS_BITS-1 downto 0);   --! y position of the star pixel.
+            pix_val             : in std_logic_vector(DATA_BITS-1 downto 0);    --! Value of the star pixel.
+            updated             : out std_logic_vector(MAX_CDPUS-1 downto 0);   --! High for the CDPUs updated by the last star pixel.
+            x_out               : out std_logic_vector(MAX_CDPUS*(COORD_BITS+POS_BITS)-1 downto 0); --! x positions of the centroids.
+            y_out               : out std_logic_vector(MAX_CDPUS*(COORD_BITS+POS_BITS)-1 downto 0); --! y positions of the centroids.
+            value_out           : out std_logic_vector(MAX_CDPUS*DATA_BITS-1 downto 0);             --! Values of the centroids.
+            pixels_out          : out std_logic_vector(MAX_CDPUS*32-1 downto 0)                     --! Number of pixels of the centroids.
+            );
+    end component;
+
+    component CDPULog is
+        generic(
+            DATA_BITS   : natural := 8;                                         --! Pixel width in bits.
+            POS_WIDTH   : natural := 24;                                        --! Length of the position data (integer and fractional bits).
+            MAX_CDPUS   : natural := 20;                                        --! Number of CDPUs.
+            FILE_NAME   : string := "centroids.csv"                             --! Output log file name.
+            );
+        port(
+            clk         : in std_logic;                                         --! Reference clock.
+            en          : in std_logic;                                         --! Star pixel strobe (falling edge, as the CDPU bank).
+            updated     : in std_logic_vector(MAX_CDPUS-1 downto 0);            --! High for the CDPUs updated by the last star pixel.
+            x_in        : in std_logic_vector(MAX_CDPUS*POS_WIDTH-1 downto 0);  --! x positions of the centroids.
+            y_in        : in std_logic_vector(MAX_CDPUS*POS_WIDTH-1 downto 0);  --! y positions of the centroids.
+            value_in    : in std_logic_vector(MAX_CDPUS*DATA_BITS-1 downto 0);  --! Values of the centroids.
+            pixels_in   : in std_logic_vector(MAX_CDPUS*32-1 downto 0)          --! Number of pixels of the centroids.
+            );
+    end component;
+
+    -- ************* CONFIGURATION PARAMETERS *************
+    constant IMAGE_CHANNELS     : natural := 1;
+    constant IMG_MAX_LENGTH     : natural := IMG_WIDTH;
+    constant IMG_MAX_HEIGHT     : natural := IMG_HEIGHT;
+
+    -- Widths of the position counters (the x counter counts up to IMG_MAX_LENGTH-1 and the y counter up to IMG_MAX_HEIGHT)
+    constant X_COUNTER_BITS     : natural := natural(ceil(log2(real(IMG_MAX_LENGTH))));
+    constant Y_COUNTER_BITS     : natural := natural(ceil(log2(real(IMG_MAX_HEIGHT+1))));
+
+    -- Position width of the centroids (the integer bits are the default COORD_BITS of the CDPU bank)
+    constant CDPU_COORD_BITS    : natural := 16;
+    constant CDPU_POS_WIDTH     : natural := CDPU_COORD_BITS+POS_BITS;
+
+    signal master_clk       : std_logic;
+    signal pixel_clk        : std_logic;
+    signal gray_clk         : std_logic;
+    signal thresh_clk       : std_logic;
+    signal raw_pixel        : std_logic_vector(PIXEL_BITS-1 downto 0);
+    signal gray_pixel       : std_logic_vector(PIXEL_BITS-1 downto 0);
+    signal h_ref            : std_logic;
+    signal v_ref            : std_logic;
+    signal i_pos            : std_logic_vector(X_COUNTER_BITS-1 downto 0);
+    signal j_pos            : std_logic_vector(Y_COUNTER_BITS-1 downto 0);
+    signal star_px_val      : std_logic_vector(PIXEL_BITS-1 downto 0);
+    signal cdpu_updated     : std_logic_vector(MAX_CDPUS-1 downto 0);
+    signal cdpu_x           : std_logic_vector(MAX_CDPUS*CDPU_POS_WIDTH-1 downto 0);
+    signal cdpu_y           : std_logic_vector(MAX_CDPUS*CDPU_POS_WIDTH-1 downto 0);
+    signal cdpu_value       : std_logic_vector(MAX_CDPUS*PIXEL_BITS-1 downto 0);
+    signal cdpu_pixels      : std_logic_vector(MAX_CDPUS*32-1 downto 0);
+
+begin
+
+    MASTER_CLOCK : Clock    port map(clk => master_clk);
+
+    IMAGE_SENSOR : Sensor   generic map(
+                                DATA_BITS => PIXEL_BITS,
+                                CHANNELS => IMAGE_CHANNELS,
+                                IMAGE_FILE => IMAGE_FILE,
+                                IMAGE_WIDTH => IMG_WIDTH,
+                                IMAGE_HEIGHT => IMG_HEIGHT,
+                                RAW_INPUT => RAW_INPUT
+                                )
+                            port map(
+                                clk => master_clk,
+                                rst => master_clk,
+                                pixclk => pixel_clk,
+                                hsync => h_ref,
+                                vsync => v_ref,
+                                data => raw_pixel
+                                );
+
+    GRAY_CONV : Grayscale   generic map(
+                                DATA_WIDTH => PIXEL_BITS,
+                                IMG_CHS => IMAGE_CHANNELS
+                                )
+                            port map(
+                                clk => pixel_clk,
+                                rst => '1',
+                                data_in => raw_pixel,
+                                data_out => gray_pixel,
+                                pixclk => gray_clk
+                                );
+
+    TH_FILTER : Threshold   generic map(
+                                DATA_WIDTH => PIXEL_BITS,
+                                TH_VALUE => STAR_THRESHOLD_VAL
+                                )
+                            port map(
+                                clk => pixel_clk,
+                                en => gray_clk,
+                                data_in => gray_pixel,
+                                data_out => star_px_val,
+                                pixclk => thresh_clk
+                                );
+
+    X_AX_COUNTER : Counter  generic map(
+                                UPPER_LIMIT => IMG_MAX_LENGTH-1,
+                                INIT_VALUE  => IMG_MAX_LENGTH-1
+                                )
+                            port map(
+                                clk     => pixel_clk,
+                                en      => h_ref,
+                                dir     => '1',
+                                rst     => h_ref,
+                                output  => i_pos
+                                );
+
+    Y_AX_COUNTER : Counter  generic map(
+                                UPPER_LIMIT => IMG_MAX_HEIGHT,
+                                INIT_VALUE  => 0
+                                )
+                            port map(
+                                clk     => h_ref,
+                                en      => v_ref,
+                                dir     => '1',
+                                rst     => v_ref,
+                                output  => j_pos
+                                );
+
+    CENTROIDER : CDPUBank   generic map(
+                                DATA_BITS           => PIXEL_BITS,
+                                X_POS_BITS          => X_COUNTER_BITS,
+                                Y_POS_BITS          => Y_COUNTER_BITS,
+                                MAX_CDPUS           => MAX_CDPUS,
+                                DISTANCE_THRESHOLD  => DISTANCE_THRESHOLD,
+                                GAIN_BITS           => GAIN_BITS,
+                                POS_BITS            => POS_BITS,
+                                CORR_FACTOR         => CORR_FACTOR,
+                                GATE                => GATE,
+                                COORD_BITS          => CDPU_COORD_BITS
+                                )
+                            port map(
+                                en          => thresh_clk,
+                                x_pos       => i_pos,
+                                y_pos       => j_pos,
+                                pix_val     => star_px_val,
+                                updated     => cdpu_updated,
+                                x_out       => cdpu_x,
+                                y_out       => cdpu_y,
+                                value_out   => cdpu_value,
+                                pixels_out  => cdpu_pixels
+                                );
+
+    -- Simulation only
+    CENTROIDS_LOG : CDPULog generic map(
+                                DATA_BITS   => PIXEL_BITS,
+                                POS_WIDTH   => CDPU_POS_WIDTH,
+                                MAX_CDPUS   => MAX_CDPUS,
+                                FILE_NAME   => LOG_FILE
+                                )
+                            port map(
+                                clk         => master_clk,
+                                en          => thresh_clk,
+                                updated     => cdpu_updated,
+                                x_in        => cdpu_x,
+                                y_in        => cdpu_y,
+                                value_in    => cdpu_value,
+                                pixels_in   => cdpu_pixels
+                                );
+
+end behavior;
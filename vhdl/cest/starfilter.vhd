@@ -36,7 +36,14 @@ library ieee;
 
 entity StarFilter is
     generic(
-        STAR_THRESHOLD_VAL : natural := 150
+        STAR_THRESHOLD_VAL : natural := 150;
+        IMAGE_FILE         : string := "/tmp/img_buf.pgm";
+        LOG_FILE           : string := "/tmp/star_pixels.csv";
+        LOG_BINARY         : boolean := FALSE;
+        PIXEL_BITS         : natural := 8;
+        IMG_WIDTH          : natural := 800;
+        IMG_HEIGHT         : natural := 600;
+        RAW_INPUT          : boolean := FALSE
         );
 end StarFilter;
 
@@ -51,7 +58,11 @@ architecture behavior of StarFilter is
     component Sensor is
         generic(
             DATA_BITS   : natural := 8;                                 --! Pixel size in bits (Sensor dependent).
-            CHANNELS    : natural := 3                                  --! Pixel channels.
+            CHANNELS    : natural := 3;                                 --! Pixel channels.
+            IMAGE_FILE  : string := "/tmp/img_buf.pgm";                 --! Input image file (Netpbm or raw).
+            IMAGE_WIDTH : natural := 800;                               --! Image width in pixels.
+            IMAGE_HEIGHT : natural := 600;                              --! Image height in pixels.
+            RAW_INPUT   : boolean := FALSE                              --! TRUE/FALSE to read a raw image.
             );
         port(
             clk         : in std_logic;                                 --! Clock source.
@@ -101,7 +112,7 @@ architecture behavior of StarFilter is
             en          : in std_logic;                                                             --! Enable signal.
             dir         : in std_logic;                                                             --! Counting direction ('1' = up, '0' = down).
             rst         : in std_logic;                                                             --! Resets counting (go back to 0).
-            output      : out std_logic_vector(natural(ceil(log2(real(UPPER_LIMIT))))-1 downto 0)   --! Counter output.
+            output      : out std_logic_vector(natural(ceil(log2(real(UPPER_LIMIT+1))))-1 downto 0)   --! Counter output.
             );
     end component;
 
@@ -111,7 +122,8 @@ architecture behavior of StarFilter is
             X_POS_BITS  : natural := 8;                                     --! Length of the x position data.
             Y_POS_BITS  : natural := 8;                                     --! Length of the y position data.
             PRINT_DATA  : boolean := FALSE;                                 --! TRUE/FALSE to print the log data on the screen.
-            FILE_NAME   : string := "star_pixels.csv"                       --! Output log file name.
+            FILE_NAME   : string := "star_pixels.csv";                      --! Output log file name.
+            BINARY      : boolean := FALSE                                  --! TRUE/FALSE to write binary records instead of CSV lines.
             );
         port(
             log_data    : in std_logic;                                     --! Enables a log line writing.
@@ -122,13 +134,16 @@ architecture behavior of StarFilter is
     end component;
 
     -- ************* CONFIGURATION PARAMETERS *************
-    constant PIXEL_BITS         : natural := 8;
     constant IMAGE_CHANNELS     : natural := 1;
-    constant IMG_MAX_LENGTH     : natural := 800;
-    constant IMG_MAX_HEIGHT     : natural := 600;
+    constant IMG_MAX_LENGTH     : natural := IMG_WIDTH;
+    constant IMG_MAX_HEIGHT     : natural := IMG_HEIGHT;
     constant MAX_CENTROIDS      : natural := 256;
     constant MAX_PIX_PER_STAR   : natural := 100;
 
+    -- Widths of the position counters (the x counter counts up to IMG_MAX_LENGTH-1 and the y counter up to IMG_MAX_HEIGHT)
+    constant X_COUNTER_BITS     : natural := natural(ceil(log2(real(IMG_MAX_LENGTH))));
+    constant Y_COUNTER_BITS     : natural := natural(ceil(log2(real(IMG_MAX_HEIGHT+1))));
+
     signal master_clk       : std_logic;
     signal pixel_clk        : std_logic;
     signal gray_clk         : std_logic;
@@ -138,8 +153,8 @@ architecture behavior of StarFilter is
     signal h_ref            : std_logic;
     signal v_ref            : std_logic;
     signal memory_pos       : std_logic_vector(natural(ceil(log2(real(MAX_CENTROIDS))))-1 downto 0);
-    signal i_pos            : std_logic_vector(natural(ceil(log2(real(IMG_MAX_LENGTH))))-1 downto 0);
-    signal j_pos            : std_logic_vector(natural(ceil(log2(real(IMG_MAX_HEIGHT))))-1 downto 0);
+    signal i_pos            : std_logic_vector(X_COUNTER_BITS-1 downto 0);
+    signal j_pos            : std_logic_vector(Y_COUNTER_BITS-1 downto 0);
     signal star_px_val      : std_logic_vector(PIXEL_BITS-1 downto 0);
 
 begin
@@ -148,7 +163,11 @@ begin
 
     IMAGE_SENSOR : Sensor   generic map(
                                 DATA_BITS => PIXEL_BITS,
-                                CHANNELS => IMAGE_CHANNELS
+                                CHANNELS => IMAGE_CHANNELS,
+                                IMAGE_FILE => IMAGE_FILE,
+                                IMAGE_WIDTH => IMG_WIDTH,
+                                IMAGE_HEIGHT => IMG_HEIGHT,
+                                RAW_INPUT => RAW_INPUT
                                 )
                             port map(
                                 clk => master_clk,
@@ -185,7 +204,7 @@ begin
 
     X_AX_COUNTER : Counter  generic map(
                                 UPPER_LIMIT => IMG_MAX_LENGTH-1,
-                                INIT_VALUE  => 799
+                                INIT_VALUE  => IMG_MAX_LENGTH-1
                                 )
                             port map(
                                 clk     => pixel_clk,
@@ -209,10 +228,11 @@ begin
 
     BIN_LOG : Log           generic map(
                                 DATA_BITS   => PIXEL_BITS,
-                                X_POS_BITS  => natural(ceil(log2(real(IMG_MAX_LENGTH)))),
-                                Y_POS_BITS  => natural(ceil(log2(real(IMG_MAX_HEIGHT)))),
+                                X_POS_BITS  => X_COUNTER_BITS,
+                                Y_POS_BITS  => Y_COUNTER_BITS,
                                 PRINT_DATA  => FALSE,
-                                FILE_NAME   => "/tmp/star_pixels.csv"
+                                FILE_NAME   => LOG_FILE,
+                                BINARY      => LOG_BINARY
                                 )
                             port map(
                                 log_data    => thresh_clk,
@@ -0,0 +1,239 @@
+--
+-- starfilter_server.vhd
+-- 
+-- Copyright (C) 2020, Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+-- 
+-- This file is part of CEST library.
+-- 
+-- CEST library is free software: you can redistribute it and/or modify
+-- it under the terms of the GNU Lesser General Public License as published by
+-- the Free Software Foundation, either version 3 of the License, or
+-- (at your option) any later version.
+-- 
+-- CEST library is distributed in the hope that it will be useful,
+-- but WITHOUT ANY WARRANTY; without even the implied warranty of
+-- MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+-- GNU Lesser General Public License for more details.
+-- 
+-- You should have received a copy of the GNU Lesser General Public License
+-- along with CEST library. If not, see <http://www.gnu.org/licenses/>.
+-- 
+--
+
+--! 
+--! \brief Persistent star pixels filter simulation (co-simulation server).
+--! 
+--! \details The same filter pipeline of the StarFilter block, but fed by the SensorStream block. The simulation keeps
+--!          running and processes one frame after the other, so the design is analyzed and elaborated only once. The
+--!          star pixels of each frame are written to RESP_FILE (usually a named pipe), which is opened at the
+--!          beginning of the frame and closed at its end.
+--! 
+--! \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+--! 
+--! \version 0.1.0
+--! 
+--! \date 18/10/2026
+--! 
+
+library ieee;
+    use ieee.std_logic_1164.all;
+    use ieee.numeric_std.all;
+    use ieee.math_real.all;
+    use std.textio.all;
+
+entity StarFilterServer is
+    generic(
+        CMD_FILE        : string := "/tmp/cest_cmd";                    --! Input file with the frames.
+        RESP_FILE       : string := "/tmp/cest_resp";                   --! Output file with the star pixels of each frame.
+        IMG_MAX_LENGTH  : natural := 4096;                              --! Maximum image width.
+        IMG_MAX_HEIGHT  : natural := 4096                               --! Maximum image height.
+        );
+end StarFilterServer;
+
+architecture behavior of StarFilterServer is
+
+    component Clock is
+        port(
+            clk         : out std_logic
+            );
+    end component;
+
+    component SensorStream is
+        generic(
+            DATA_BITS           : natural := 8;
+            CMD_FILE            : string := "/tmp/cest_cmd";
+            BLANK_REGION_CLKS   : natural := 15
+            );
+        port(
+            clk         : in std_logic;
+            pixclk      : out std_logic;
+            hsync       : out std_logic;
+            vsync       : out std_logic;
+            data        : out std_logic_vector(DATA_BITS-1 downto 0);
+            threshold   : out std_logic_vector(DATA_BITS-1 downto 0);
+            frame       : out std_logic
+            );
+    end component;
+
+    component Grayscale is
+        generic(
+            DATA_WIDTH  : natural := 8;
+            IMG_CHS     : natural := 3
+            );
+        port(
+            clk         : in std_logic;
+            rst         : in std_logic;
+            data_in     : in std_logic_vector(DATA_WIDTH-1 downto 0);
+            data_out    : out std_logic_vector(DATA_WIDTH-1 downto 0);
+            pixclk      : out std_logic
+            );
+    end component;
+
+    component Threshold is
+        generic(
+            DATA_WIDTH  : natural := 8;
+            TH_VALUE    : natural := 200;
+            USE_TH_PORT : boolean := FALSE
+            );
+        port(
+            clk         : in std_logic;
+            en          : in std_logic;
+            data_in     : in std_logic_vector(DATA_WIDTH-1 downto 0);
+            th_in       : in std_logic_vector(DATA_WIDTH-1 downto 0) := (others => '0');
+            data_out    : out std_logic_vector(DATA_WIDTH-1 downto 0);
+            pixclk      : out std_logic
+            );
+    end component;
+
+    component Counter is
+        generic(
+            UPPER_LIMIT : natural := 64;
+            INIT_VALUE  : natural := 0
+            );
+        port(
+            clk         : in std_logic;
+            en          : in std_logic;
+            dir         : in std_logic;
+            rst         : in std_logic;
+            output      : out std_logic_vector(natural(ceil(log2(real(UPPER_LIMIT+1))))-1 downto 0)
+            );
+    end component;
+
+    -- ************* CONFIGURATION PARAMETERS *************
+    constant PIXEL_BITS         : natural := 8;
+    constant IMAGE_CHANNELS     : natural := 1;
+
+    -- Widths of the position counters (the x counter counts up to IMG_MAX_LENGTH-1 and the y counter up to IMG_MAX_HEIGHT)
+    constant X_COUNTER_BITS     : natural := natural(ceil(log2(real(IMG_MAX_LENGTH))));
+    constant Y_COUNTER_BITS     : natural := natural(ceil(log2(real(IMG_MAX_HEIGHT+1))));
+
+    signal master_clk       : std_logic;
+    signal pixel_clk        : std_logic;
+    signal gray_clk         : std_logic;
+    signal thresh_clk       : std_logic;
+    signal frame_active     : std_logic;
+    signal raw_pixel        : std_logic_vector(PIXEL_BITS-1 downto 0);
+    signal gray_pixel       : std_logic_vector(PIXEL_BITS-1 downto 0);
+    signal th_value         : std_logic_vector(PIXEL_BITS-1 downto 0);
+    signal h_ref            : std_logic;
+    signal v_ref            : std_logic;
+    signal i_pos            : std_logic_vector(X_COUNTER_BITS-1 downto 0);
+    signal j_pos            : std_logic_vector(Y_COUNTER_BITS-1 downto 0);
+    signal star_px_val      : std_logic_vector(PIXEL_BITS-1 downto 0);
+
+begin
+
+    MASTER_CLOCK : Clock        port map(clk => master_clk);
+
+    IMAGE_SENSOR : SensorStream generic map(
+                                    DATA_BITS => PIXEL_BITS,
+                                    CMD_FILE => CMD_FILE
+                                    )
+                                port map(
+                                    clk => master_clk,
+                                    pixclk => pixel_clk,
+                                    hsync => h_ref,
+                                    vsync => v_ref,
+                                    data => raw_pixel,
+                                    threshold => th_value,
+                                    frame => frame_active
+                                    );
+
+    GRAY_CONV : Grayscale       generic map(
+                                    DATA_WIDTH => PIXEL_BITS,
+                                    IMG_CHS => IMAGE_CHANNELS
+                                    )
+                                port map(
+                                    clk => pixel_clk,
+                                    rst => '1',
+                                    data_in => raw_pixel,
+                                    data_out => gray_pixel,
+                                    pixclk => gray_clk
+                                    );
+
+    TH_FILTER : Threshold       generic map(
+                                    DATA_WIDTH => PIXEL_BITS,
+                                    USE_TH_PORT => TRUE
+                                    )
+                                port map(
+                                    clk => pixel_clk,
+                                    en => gray_clk,
+                                    data_in => gray_pixel,
+                                    th_in => th_value,
+                                    data_out => star_px_val,
+                                    pixclk => thresh_clk
+                                    );
+
+    X_AX_COUNTER : Counter      generic map(
+                                    UPPER_LIMIT => IMG_MAX_LENGTH-1,
+                                    INIT_VALUE  => IMG_MAX_LENGTH-1
+                                    )
+                                port map(
+                                    clk     => pixel_clk,
+                                    en      => h_ref,
+                                    dir     => '1',
+                                    rst     => h_ref,
+                                    output  => i_pos
+                                    );
+
+    Y_AX_COUNTER : Counter      generic map(
+                                    UPPER_LIMIT => IMG_MAX_HEIGHT,
+                                    INIT_VALUE  => 0
+                                    )
+                                port map(
+                                    clk     => h_ref,
+                                    en      => v_ref,
+                                    dir     => '1',
+                                    rst     => v_ref,
+                                    output  => j_pos
+                                    );
+
+    -- Star pixels log (the file is kept open during the frame, and closed to signalize its end)
+    FRAME_LOG : process(thresh_clk, frame_active)
+
+        file resp_file      : text;
+        variable log_line   : line;
+
+        begin
+
+        if rising_edge(frame_active) then
+            file_open(resp_file, RESP_FILE, write_mode);
+        end if;
+
+        if falling_edge(thresh_clk) and (frame_active = '1') then
+            write(log_line, integer'image(to_integer(unsigned(star_px_val))), right, 1);
+            write(log_line, string'(","));
+            write(log_line, integer'image(to_integer(unsigned(i_pos))), right, 1);
+            write(log_line, string'(","));
+            write(log_line, integer'image(to_integer(unsigned(j_pos))), right, 1);
+
+            writeline(resp_file, log_line);
+        end if;
+
+        if falling_edge(frame_active) then
+            file_close(resp_file);
+        end if;
+
+    end process;
+
+end behavior;
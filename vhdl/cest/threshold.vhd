@@ -37,12 +37,14 @@ library ieee;
 entity Threshold is
     generic(
         DATA_WIDTH  : natural := 8;                                 --! Pixel width in bits.
-        TH_VALUE    : natural := 200                                --! Threshold value (0 to 255).
+        TH_VALUE    : natural := 200;                               --! Threshold value (0 to 2**DATA_WIDTH-1).
+        USE_TH_PORT : boolean := FALSE                              --! TRUE/FALSE to use the th_in port or TH_VALUE as the threshold value.
         );
     port(
         clk         : in std_logic;                                 --! Clock source.
         en          : in std_logic;                                 --! Enable signal (Activation "clock").
         data_in     : in std_logic_vector(DATA_WIDTH-1 downto 0);   --! Data input (gray scale pixels).
+        th_in       : in std_logic_vector(DATA_WIDTH-1 downto 0) := (others => '0');    --! Threshold value (runtime, if USE_TH_PORT = TRUE).
         data_out    : out std_logic_vector(DATA_WIDTH-1 downto 0);  --! Data output (above threshold pixels).
         pixclk      : out std_logic                                 --! Signalizes when to pick the data from the output.
         );
@@ -51,9 +53,12 @@ end Threshold;
 architecture behavior of Threshold is
 
     signal pixclk_sig : std_logic := '0';
+    signal th_sig     : std_logic_vector(DATA_WIDTH-1 downto 0);
 
 begin
 
+    th_sig <= th_in when (USE_TH_PORT = TRUE) else std_logic_vector(to_unsigned(TH_VALUE, DATA_WIDTH));
+
     process(clk, en)
     begin
         if falling_edge(clk) then
@@ -61,11 +66,11 @@ begin
         end if;
 
         if falling_edge(en) then
-            if (data_in > std_logic_vector(to_unsigned(TH_VALUE, DATA_WIDTH))) then
+            if (data_in > th_sig) then
                 data_out <= data_in;
                 pixclk_sig <= '1';
             else
-                data_out <= x"00";
+                data_out <= (others => '0');
             end if;
         end if;
     end process;